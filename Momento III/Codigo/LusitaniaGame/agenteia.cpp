@@ -1,4 +1,5 @@
 #include "agenteia.h"
+#include "perfilador.h"
 
 // ========== CONSTRUCTORES ==========
 
@@ -19,7 +20,7 @@ AgenteIA::AgenteIA()
     aprendizaje = new SistemaAprendizaje(20);
 }
 
-AgenteIA::AgenteIA(Entidad* agenteSub, Entidad* obj)
+AgenteIA::AgenteIA(Entidad* agenteSub, Entidad* obj, GeneradorAleatorio* gen)
     : percepcion(nullptr),
     razonamiento(nullptr),
     accion(nullptr),
@@ -31,7 +32,7 @@ AgenteIA::AgenteIA(Entidad* agenteSub, Entidad* obj)
 
     // Crear los 4 subsistemas
     percepcion = new SistemaPercepcion(300.0f);
-    razonamiento = new SistemaRazonamiento(perfil);
+    razonamiento = new SistemaRazonamiento(perfil, gen);
     accion = new SistemaAccion();
     aprendizaje = new SistemaAprendizaje(20);
 }
@@ -69,6 +70,8 @@ void AgenteIA::actualizar(float dt) {
         return;
     }
 
+    TemporizadorPerfil t(SeccionPerfil::IA);
+
     // ===== PASO 1: PERCEPCION =====
     // Detectar y rastrear al objetivo
     datosPercepcion = percepcion->detectar(agente, objetivo, dt);
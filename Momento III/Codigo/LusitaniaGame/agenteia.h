@@ -37,7 +37,7 @@ private:
 public:
     // ========== CONSTRUCTORES ==========
     AgenteIA();
-    AgenteIA(Entidad* agenteSub, Entidad* obj);
+    AgenteIA(Entidad* agenteSub, Entidad* obj, GeneradorAleatorio* gen = nullptr);
     ~AgenteIA();
 
     // ========== CICLO PRINCIPAL ==========
@@ -0,0 +1,332 @@
+#include "archivoassets.h"
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QtEndian>
+#include <QDebug>
+#include <cstring>
+
+const char* const ArchivoAssets::FIRMA = "LUSPAK01";
+ArchivoAssets* ArchivoAssets::compartido = nullptr;
+
+namespace {
+
+const int TAMANO_FIRMA = 8;
+const int TAMANO_CABECERA = TAMANO_FIRMA + 4;
+
+qint64 alinear(qint64 posicion) {
+    return (posicion + ArchivoAssets::ALINEACION - 1) / ArchivoAssets::ALINEACION * ArchivoAssets::ALINEACION;
+}
+
+// Libera los pixeles descomprimidos cuando el QImage deja de usarlos
+void liberarPixeles(void* datos) {
+    delete static_cast<QByteArray*>(datos);
+}
+
+} // namespace
+
+// ========== CONSTRUCTOR ==========
+
+ArchivoAssets::ArchivoAssets()
+    : mapa(nullptr),
+    tamanoMapa(0) {
+}
+
+ArchivoAssets::~ArchivoAssets() {
+    cerrar();
+}
+
+// ========== APERTURA ==========
+
+QString ArchivoAssets::rutaPredeterminada() {
+    return QCoreApplication::applicationDirPath() + "/assets.lpk";
+}
+
+bool ArchivoAssets::abrir(const QString& ruta) {
+    cerrar();
+
+    archivo.setFileName(ruta);
+    if (!archivo.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    tamanoMapa = archivo.size();
+    mapa = tamanoMapa > TAMANO_CABECERA ? archivo.map(0, tamanoMapa) : nullptr;
+
+    if (!mapa || !leerIndice()) {
+        qWarning() << "[ArchivoAssets] Archivo invalido:" << ruta;
+        cerrar();
+        return false;
+    }
+
+    qDebug() << "[ArchivoAssets] Abierto:" << ruta << "-" << paginas.size() << "paginas,"
+             << regiones.size() << "sprites," << datos.size() << "datos";
+    return true;
+}
+
+void ArchivoAssets::cerrar() {
+    if (mapa) {
+        archivo.unmap(const_cast<uchar*>(mapa));
+        mapa = nullptr;
+    }
+    if (archivo.isOpen()) {
+        archivo.close();
+    }
+
+    tamanoMapa = 0;
+    paginas.clear();
+    regiones.clear();
+    datos.clear();
+}
+
+bool ArchivoAssets::leerIndice() {
+    if (std::memcmp(mapa, FIRMA, TAMANO_FIRMA) != 0) return false;
+
+    quint32 tamanoIndice = qFromLittleEndian<quint32>(mapa + TAMANO_FIRMA);
+    if (TAMANO_CABECERA + static_cast<qint64>(tamanoIndice) > tamanoMapa) return false;
+
+    QByteArray indice = QByteArray::fromRawData(reinterpret_cast<const char*>(mapa + TAMANO_CABECERA),
+                                                static_cast<int>(tamanoIndice));
+    QDataStream entrada(indice);
+    entrada.setVersion(QDataStream::Qt_6_0);
+
+    // Un bloque que se sale del archivo = archivo truncado o corrupto
+    auto bloqueValido = [this](qint64 offset, qint64 tamano) {
+        return offset >= 0 && tamano >= 0 && offset + tamano <= tamanoMapa;
+    };
+
+    qint32 numPaginas = 0;
+    QMap<int, QVector<QSize>> paginasPorPaquete;       // Tamaños, en orden local
+    entrada >> numPaginas;
+    for (qint32 i = 0; i < numPaginas && entrada.status() == QDataStream::Ok; i++) {
+        EntradaPagina e;
+        qint32 paquete, ancho, alto;
+        entrada >> paquete >> ancho >> alto >> e.comprimida >> e.offset >> e.tamano;
+        e.paquete = paquete;
+        e.ancho = ancho;
+        e.alto = alto;
+
+        if (!bloqueValido(e.offset, e.tamano)) return false;
+        if (!e.comprimida && e.tamano != static_cast<qint64>(e.ancho) * e.alto * 4) return false;
+        paginas.append(e);
+        paginasPorPaquete[e.paquete].append(QSize(e.ancho, e.alto));
+    }
+
+    qint32 numRegiones = 0;
+    entrada >> numRegiones;
+    for (qint32 i = 0; i < numRegiones && entrada.status() == QDataStream::Ok; i++) {
+        EntradaRegion e;
+        qint32 paquete, pagina;
+        QRect rect;
+        entrada >> e.nombre >> paquete >> pagina >> rect;
+
+        // La pagina es relativa al paquete: fuera de sus paginas se leeria
+        // una ajena (o ninguna) al dibujar, y un rectangulo que se sale de
+        // la pagina recortaria pixeles de fuera de la imagen
+        const QVector<QSize> tamanos = paginasPorPaquete.value(paquete);
+        if (pagina < 0 || pagina >= tamanos.size()) return false;
+        if (!QRect(QPoint(0, 0), tamanos[pagina]).contains(rect)) return false;
+
+        e.paquete = paquete;
+        e.region = RegionSprite(pagina, rect);
+        regiones.append(e);
+    }
+
+    qint32 numDatos = 0;
+    entrada >> numDatos;
+    for (qint32 i = 0; i < numDatos && entrada.status() == QDataStream::Ok; i++) {
+        QString nombre;
+        EntradaDatos e;
+        entrada >> nombre >> e.offset >> e.tamano;
+
+        if (!bloqueValido(e.offset, e.tamano)) return false;
+        datos[nombre] = e;
+    }
+
+    return entrada.status() == QDataStream::Ok;
+}
+
+// ========== INSTANCIA COMPARTIDA ==========
+
+ArchivoAssets* ArchivoAssets::obtenerCompartido() {
+    if (!compartido) {
+        compartido = new ArchivoAssets();
+        compartido->abrir(rutaPredeterminada());
+    }
+    return compartido;
+}
+
+void ArchivoAssets::destruirCompartido() {
+    delete compartido;
+    compartido = nullptr;
+}
+
+// ========== LECTURA ==========
+
+bool ArchivoAssets::tienePaquete(int paquete) const {
+    for (const EntradaPagina& e : paginas) {
+        if (e.paquete == paquete) return true;
+    }
+    return false;
+}
+
+AtlasTexturas ArchivoAssets::leerPaquete(int paquete) const {
+    AtlasTexturas atlas;
+    if (!mapa) return atlas;
+
+    for (const EntradaPagina& e : paginas) {
+        if (e.paquete != paquete) continue;
+
+        const uchar* bloque = mapa + e.offset;
+        qint64 bytesPagina = static_cast<qint64>(e.ancho) * e.alto * 4;
+        QImage pagina;
+
+        if (e.comprimida) {
+            QByteArray* pixeles = new QByteArray(qUncompress(bloque, e.tamano));
+
+            if (pixeles->size() == bytesPagina) {
+                pagina = QImage(reinterpret_cast<const uchar*>(pixeles->constData()),
+                                e.ancho, e.alto, e.ancho * 4,
+                                QImage::Format_ARGB32_Premultiplied, liberarPixeles, pixeles);
+            } else {
+                qWarning() << "[ArchivoAssets] Pagina corrupta en el paquete" << paquete;
+                delete pixeles;
+            }
+        } else {
+            // Directo desde el mapa (solo lectura): sin copia ni decodificacion
+            pagina = QImage(bloque, e.ancho, e.alto, e.ancho * 4, QImage::Format_ARGB32_Premultiplied);
+        }
+
+        // Aun vacia, la pagina ocupa su indice: las regiones apuntan por posicion
+        atlas.agregarPagina(pagina);
+    }
+
+    for (const EntradaRegion& e : regiones) {
+        if (e.paquete == paquete) {
+            atlas.agregarRegion(e.nombre, e.region);
+        }
+    }
+
+    return atlas;
+}
+
+QByteArray ArchivoAssets::getDatos(const QString& nombre) const {
+    auto it = datos.constFind(nombre);
+    if (!mapa || it == datos.constEnd()) return QByteArray();
+
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(mapa + it.value().offset),
+                                   static_cast<int>(it.value().tamano));
+}
+
+// ========== ESCRITURA (EMPAQUETADOR) ==========
+
+bool ArchivoAssets::escribir(const QString& ruta,
+                             const QMap<int, AtlasTexturas>& paquetes,
+                             const QMap<QString, QByteArray>& datosEntrada,
+                             bool comprimir) {
+    // 1. Bloques, con offsets relativos al inicio de la zona de bloques
+    QByteArray bloques;
+    QVector<EntradaPagina> entradasPaginas;
+    QVector<EntradaRegion> entradasRegiones;
+    QMap<QString, EntradaDatos> entradasDatos;
+
+    auto agregarBloque = [&bloques](const QByteArray& bloque) {
+        bloques.append(QByteArray(static_cast<int>(alinear(bloques.size()) - bloques.size()), '\0'));
+        qint64 offset = bloques.size();
+        bloques.append(bloque);
+        return offset;
+    };
+
+    for (auto it = paquetes.constBegin(); it != paquetes.constEnd(); ++it) {
+        const AtlasTexturas& atlas = it.value();
+
+        for (int i = 0; i < atlas.getNumPaginas(); i++) {
+            QImage pagina = atlas.getPagina(i).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+            // Fila por fila: el arreglo queda compacto (ancho * 4 por fila)
+            QByteArray pixeles;
+            pixeles.reserve(pagina.width() * pagina.height() * 4);
+            for (int y = 0; y < pagina.height(); y++) {
+                pixeles.append(reinterpret_cast<const char*>(pagina.constScanLine(y)), pagina.width() * 4);
+            }
+
+            bool comprimida = false;
+            if (comprimir) {
+                QByteArray comprimidos = qCompress(pixeles, 9);
+                if (comprimidos.size() < pixeles.size()) {
+                    pixeles = comprimidos;
+                    comprimida = true;
+                }
+            }
+
+            EntradaPagina e;
+            e.paquete = it.key();
+            e.ancho = pagina.width();
+            e.alto = pagina.height();
+            e.comprimida = comprimida;
+            e.tamano = pixeles.size();
+            e.offset = agregarBloque(pixeles);
+            entradasPaginas.append(e);
+        }
+
+        const QMap<QString, RegionSprite>& regionesAtlas = atlas.getRegiones();
+        for (auto r = regionesAtlas.constBegin(); r != regionesAtlas.constEnd(); ++r) {
+            entradasRegiones.append({r.key(), it.key(), r.value()});
+        }
+    }
+
+    for (auto it = datosEntrada.constBegin(); it != datosEntrada.constEnd(); ++it) {
+        EntradaDatos e;
+        e.tamano = it.value().size();
+        e.offset = agregarBloque(it.value());
+        entradasDatos[it.key()] = e;
+    }
+
+    // 2. Indice. Su tamaño no depende de los valores de los offsets
+    //    (enteros fijos), asi que se serializa una vez para medirlo y
+    //    otra con los offsets absolutos
+    auto serializarIndice = [&](qint64 base) {
+        QByteArray indice;
+        QDataStream salida(&indice, QIODevice::WriteOnly);
+        salida.setVersion(QDataStream::Qt_6_0);
+
+        salida << static_cast<qint32>(entradasPaginas.size());
+        for (const EntradaPagina& e : entradasPaginas) {
+            salida << static_cast<qint32>(e.paquete) << static_cast<qint32>(e.ancho)
+                   << static_cast<qint32>(e.alto) << e.comprimida << (base + e.offset) << e.tamano;
+        }
+
+        salida << static_cast<qint32>(entradasRegiones.size());
+        for (const EntradaRegion& e : entradasRegiones) {
+            salida << e.nombre << static_cast<qint32>(e.paquete)
+                   << static_cast<qint32>(e.region.pagina) << e.region.rect;
+        }
+
+        salida << static_cast<qint32>(entradasDatos.size());
+        for (auto it = entradasDatos.constBegin(); it != entradasDatos.constEnd(); ++it) {
+            salida << it.key() << (base + it.value().offset) << it.value().tamano;
+        }
+
+        return indice;
+    };
+
+    qint64 base = alinear(TAMANO_CABECERA + serializarIndice(0).size());
+    QByteArray indice = serializarIndice(base);
+
+    // 3. Archivo: cabecera, indice, relleno y bloques
+    QFile salida(ruta);
+    if (!salida.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "[ArchivoAssets] No se pudo escribir:" << ruta;
+        return false;
+    }
+
+    uchar tamanoIndice[4];
+    qToLittleEndian<quint32>(static_cast<quint32>(indice.size()), tamanoIndice);
+
+    salida.write(FIRMA, TAMANO_FIRMA);
+    salida.write(reinterpret_cast<const char*>(tamanoIndice), 4);
+    salida.write(indice);
+    salida.write(QByteArray(static_cast<int>(base - TAMANO_CABECERA - indice.size()), '\0'));
+    salida.write(bloques);
+
+    return true;
+}
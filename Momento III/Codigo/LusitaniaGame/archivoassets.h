@@ -0,0 +1,104 @@
+#ifndef ARCHIVOASSETS_H
+#define ARCHIVOASSETS_H
+
+#include "atlastexturas.h"
+#include <QByteArray>
+#include <QFile>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+// Archivo unico de assets (.lpk), generado por empaquetador/ a partir de
+// assets/. Reemplaza la carpeta suelta: se abre una vez y se mapea a
+// memoria (QFile::map), sin buscar rutas ni decodificar PNG/JPG.
+//
+// Formato:
+//   [0, 8)    "LUSPAK01"
+//   [8, 12)   tamaño del indice (quint32, little endian)
+//   [12, ...) indice (QDataStream, Qt 6.0):
+//               paginas:  paquete, ancho, alto, comprimida, offset, tamaño
+//               regiones: nombre, paquete, pagina (local al paquete), rect
+//               datos:    nombre, offset, tamaño   (sonidos, en crudo)
+//   [...]     bloques, alineados a 16 bytes
+//
+// Las paginas son atlas ya empaquetados en ARGB32 premultiplicado (el
+// formato nativo de QPixmap en el raster), opcionalmente con qCompress.
+// Una pagina sin comprimir se usa directo desde el mapa, sin copias.
+// Los pixeles se guardan en el orden de bytes de la maquina que empaqueta.
+class ArchivoAssets {
+private:
+    struct EntradaPagina {
+        int paquete;
+        int ancho;
+        int alto;
+        bool comprimida;
+        qint64 offset;
+        qint64 tamano;
+    };
+
+    struct EntradaRegion {
+        QString nombre;
+        int paquete;
+        RegionSprite region;        // Pagina local al paquete
+    };
+
+    struct EntradaDatos {
+        qint64 offset;
+        qint64 tamano;
+    };
+
+    static ArchivoAssets* compartido;
+
+    QFile archivo;
+    const uchar* mapa;
+    qint64 tamanoMapa;
+
+    QVector<EntradaPagina> paginas;
+    QVector<EntradaRegion> regiones;
+    QMap<QString, EntradaDatos> datos;
+
+    bool leerIndice();
+
+public:
+    static const char* const FIRMA;             // "LUSPAK01"
+    static const int ALINEACION = 16;
+
+    // ========== CONSTRUCTOR ==========
+    ArchivoAssets();
+    ~ArchivoAssets();
+
+    ArchivoAssets(const ArchivoAssets&) = delete;
+    ArchivoAssets& operator=(const ArchivoAssets&) = delete;
+
+    // ========== APERTURA ==========
+    bool abrir(const QString& ruta);
+    void cerrar();
+    bool estaAbierto() const { return mapa != nullptr; }
+
+    // Junto al ejecutable: unico lugar donde se busca
+    static QString rutaPredeterminada();
+
+    // ========== INSTANCIA COMPARTIDA ==========
+    // assets.lpk abierto y mapeado una sola vez para GestorSprites y
+    // GestorSonidos (cerrado si no existe). Se destruye despues de ambos
+    static ArchivoAssets* obtenerCompartido();
+    static void destruirCompartido();
+
+    // ========== LECTURA ==========
+    // Constantes tras abrir(): se pueden llamar desde cualquier hilo
+    bool tienePaquete(int paquete) const;
+    AtlasTexturas leerPaquete(int paquete) const;
+
+    bool tieneDatos(const QString& nombre) const { return datos.contains(nombre); }
+    // Sin copia: apunta al mapa, valido mientras el archivo este abierto
+    QByteArray getDatos(const QString& nombre) const;
+
+    // ========== ESCRITURA (empaquetador) ==========
+    // paquetes: numero de paquete -> atlas ya empaquetado (con pixeles)
+    static bool escribir(const QString& ruta,
+                         const QMap<int, AtlasTexturas>& paquetes,
+                         const QMap<QString, QByteArray>& datos,
+                         bool comprimir);
+};
+
+#endif // ARCHIVOASSETS_H
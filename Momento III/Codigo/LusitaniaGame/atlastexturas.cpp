@@ -0,0 +1,140 @@
+#include "atlastexturas.h"
+#include <QPainter>
+#include <algorithm>
+
+// ========== CONSTRUCTOR ==========
+
+AtlasTexturas::AtlasTexturas(int lado, int margenSprites)
+    : ladoPagina(lado),
+    margen(margenSprites) {
+}
+
+// ========== CONSTRUCCION ==========
+
+void AtlasTexturas::agregar(const QString& nombre, const QImage& imagen) {
+    if (imagen.isNull()) return;
+    pendientes.push_back({nombre, imagen});
+}
+
+void AtlasTexturas::empaquetar() {
+    if (pendientes.empty()) return;
+
+    // Mayor alto primero: los estantes quedan parejos y se desperdicia menos
+    std::stable_sort(pendientes.begin(), pendientes.end(),
+                     [](const Pendiente& a, const Pendiente& b) {
+                         return a.imagen.height() > b.imagen.height();
+                     });
+
+    // ===== UBICAR (solo geometria) =====
+    struct Ubicacion {
+        int pagina;
+        QRect rect;
+    };
+
+    std::vector<Ubicacion> ubicaciones(pendientes.size());
+    std::vector<QSize> tamanos;        // Alto usado por pagina nueva
+
+    int primera = paginas.size();
+    int pagina = -1;
+    int x = 0, y = 0, altoEstante = 0;
+
+    for (size_t i = 0; i < pendientes.size(); i++) {
+        int w = pendientes[i].imagen.width();
+        int h = pendientes[i].imagen.height();
+
+        // Mas grande que una pagina: pagina propia a su medida
+        if (w + margen > ladoPagina || h + margen > ladoPagina) {
+            tamanos.push_back(QSize(w, h));
+            ubicaciones[i] = {primera + static_cast<int>(tamanos.size()) - 1, QRect(0, 0, w, h)};
+            continue;
+        }
+
+        // Nuevo estante si no cabe en la fila
+        if (pagina >= 0 && x + w > ladoPagina) {
+            x = 0;
+            y += altoEstante + margen;
+            altoEstante = 0;
+        }
+
+        // Nueva pagina si el estante no cabe
+        if (pagina < 0 || y + h > ladoPagina) {
+            tamanos.push_back(QSize(0, 0));
+            pagina = static_cast<int>(tamanos.size()) - 1;
+            x = 0;
+            y = 0;
+            altoEstante = 0;
+        }
+
+        ubicaciones[i] = {primera + pagina, QRect(x, y, w, h)};
+
+        x += w + margen;
+        altoEstante = std::max(altoEstante, h);
+
+        // La pagina solo crece hasta donde llega su ultimo estante
+        QSize& usado = tamanos[pagina];
+        usado = QSize(std::max(usado.width(), x - margen), std::max(usado.height(), y + altoEstante));
+    }
+
+    // ===== COPIAR PIXELES =====
+    for (const QSize& tamano : tamanos) {
+        QImage nueva(tamano.width(), tamano.height(), QImage::Format_ARGB32_Premultiplied);
+        nueva.fill(Qt::transparent);
+        paginas.append(nueva);
+        tamanosPaginas.append(tamano);
+    }
+
+    for (int p = primera; p < paginas.size(); p++) {
+        QPainter painter(&paginas[p]);
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+
+        for (size_t i = 0; i < pendientes.size(); i++) {
+            if (ubicaciones[i].pagina != p) continue;
+            painter.drawImage(ubicaciones[i].rect.topLeft(), pendientes[i].imagen);
+        }
+    }
+
+    for (size_t i = 0; i < pendientes.size(); i++) {
+        regiones[pendientes[i].nombre] = RegionSprite(ubicaciones[i].pagina, ubicaciones[i].rect);
+    }
+
+    pendientes.clear();
+}
+
+void AtlasTexturas::limpiar() {
+    pendientes.clear();
+    paginas.clear();
+    tamanosPaginas.clear();
+    regiones.clear();
+}
+
+void AtlasTexturas::liberarPixeles() {
+    for (QImage& pagina : paginas) {
+        pagina = QImage();
+    }
+}
+
+int AtlasTexturas::agregarPagina(const QImage& pagina) {
+    paginas.append(pagina);
+    tamanosPaginas.append(pagina.size());
+    return paginas.size() - 1;
+}
+
+void AtlasTexturas::agregarRegion(const QString& nombre, const RegionSprite& region) {
+    regiones[nombre] = region;
+}
+
+// ========== CONSULTA ==========
+
+float AtlasTexturas::getOcupacion() const {
+    qint64 usados = 0;
+    qint64 total = 0;
+
+    for (const RegionSprite& region : regiones) {
+        usados += static_cast<qint64>(region.rect.width()) * region.rect.height();
+    }
+    for (const QSize& tamano : tamanosPaginas) {
+        total += static_cast<qint64>(tamano.width()) * tamano.height();
+    }
+
+    return total > 0 ? static_cast<float>(usados) / total : 0.0f;
+}
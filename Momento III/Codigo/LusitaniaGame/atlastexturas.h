@@ -0,0 +1,84 @@
+#ifndef ATLASTEXTURAS_H
+#define ATLASTEXTURAS_H
+
+#include <QImage>
+#include <QMap>
+#include <QRect>
+#include <QSize>
+#include <QString>
+#include <QVector>
+#include <vector>
+
+// Handle entero de un sprite: el nombre se interna una sola vez
+// (GestorSprites::idSprite) y en el render se indexa un arreglo.
+// Es estable: no cambia al descargar y volver a cargar su paquete
+typedef int SpriteId;
+const SpriteId SPRITE_INVALIDO = -1;
+
+// Ubicacion de un sprite dentro del atlas: pagina + rectangulo fuente.
+// Es lo que se guarda en vez de un QPixmap por sprite; para dibujar se
+// usa drawPixmap(destino, pagina, rect) sin copiar pixeles.
+struct RegionSprite {
+    int pagina;         // -1 = sprite inexistente
+    QRect rect;         // En pixeles de la pagina
+
+    RegionSprite() : pagina(-1) {}
+    RegionSprite(int p, const QRect& r) : pagina(p), rect(r) {}
+
+    bool esValida() const { return pagina >= 0; }
+};
+
+// Empaquetador de atlas de texturas (en tiempo de carga)
+// Se agregan las imagenes sueltas y empaquetar() las acomoda en una o
+// pocas paginas grandes por estantes: ordenadas de mayor a menor alto,
+// de izquierda a derecha, y un estante nuevo cuando la fila se llena.
+// Entre sprites queda un margen transparente para que el filtrado
+// bilineal al escalar no mezcle pixeles del vecino.
+//
+// Solo usa QImage: puede correr sin GUI (herramientas, hilos de carga).
+class AtlasTexturas {
+private:
+    struct Pendiente {
+        QString nombre;
+        QImage imagen;
+    };
+
+    std::vector<Pendiente> pendientes;
+    QVector<QImage> paginas;
+    QVector<QSize> tamanosPaginas;  // Se conservan tras liberarPixeles()
+    QMap<QString, RegionSprite> regiones;
+
+    int ladoPagina;                 // 2048 (limite seguro de textura en GPU)
+    int margen;                     // Pixeles transparentes entre sprites (2)
+
+public:
+    // ========== CONSTRUCTOR ==========
+    explicit AtlasTexturas(int ladoPagina = 2048, int margen = 2);
+
+    // ========== CONSTRUCCION ==========
+    void agregar(const QString& nombre, const QImage& imagen);
+    // Acomoda los pendientes en paginas nuevas (las anteriores no cambian)
+    void empaquetar();
+    void limpiar();
+    // Descarta los QImage de las paginas (la geometria se conserva), una
+    // vez que quien dibuja ya tiene su copia (QPixmap, textura)
+    void liberarPixeles();
+
+    // Paginas que ya vienen empaquetadas (archivo de assets): se agregan
+    // tal cual, sin volver a acomodar nada
+    int agregarPagina(const QImage& pagina);            // Devuelve su indice
+    void agregarRegion(const QString& nombre, const RegionSprite& region);
+
+    // ========== CONSULTA ==========
+    int getNumPaginas() const { return paginas.size(); }
+    const QImage& getPagina(int i) const { return paginas[i]; }
+    QSize getTamanoPagina(int i) const { return tamanosPaginas[i]; }
+    RegionSprite getRegion(const QString& nombre) const { return regiones.value(nombre); }
+    const QMap<QString, RegionSprite>& getRegiones() const { return regiones; }
+    int getNumPendientes() const { return static_cast<int>(pendientes.size()); }
+
+    // Pixeles ocupados por sprites / pixeles de las paginas (0..1)
+    float getOcupacion() const;
+};
+
+#endif // ATLASTEXTURAS_H
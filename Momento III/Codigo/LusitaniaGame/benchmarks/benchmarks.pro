@@ -0,0 +1,9 @@
+# Todos los benchmarks:
+#   nucleo/  - lusitania_benchmarks (suite micro + macro, salida JSON)
+#   vortice/ - lusitania_bench_vortice (por entidad vs lote SIMD)
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    nucleo \
+    vortice
@@ -0,0 +1,221 @@
+#include "arnesbenchmark.h"
+#include "fisicavortice.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringList>
+#include <QDebug>
+#include <algorithm>
+#include <thread>
+#include <cstdio>
+
+// ========== ESTADO DE UNA CORRIDA ==========
+
+EstadoBenchmark::EstadoBenchmark(long long n, int arg)
+    : iteraciones(n),
+    restantes(n),
+    argumento(arg),
+    iniciado(false),
+    nsMedidos(0),
+    cpuInicio(0),
+    cpuMedido(0.0),
+    elementosProcesados(0) {
+}
+
+bool EstadoBenchmark::continuar() {
+    if (!iniciado) {
+        iniciado = true;
+        reanudarReloj();
+    }
+
+    if (restantes > 0) {
+        restantes--;
+        return true;
+    }
+
+    pausarReloj();
+    return false;
+}
+
+void EstadoBenchmark::pausarReloj() {
+    if (!reloj.isValid()) return;
+
+    nsMedidos += reloj.nsecsElapsed();
+    cpuMedido += static_cast<double>(std::clock() - cpuInicio) / CLOCKS_PER_SEC;
+    reloj.invalidate();
+}
+
+void EstadoBenchmark::reanudarReloj() {
+    cpuInicio = std::clock();
+    reloj.start();
+}
+
+void EstadoBenchmark::setContador(const QString& nombre, double valor) {
+    for (auto& contador : contadores) {
+        if (contador.first == nombre) {
+            contador.second = valor;
+            return;
+        }
+    }
+    contadores.emplace_back(nombre, valor);
+}
+
+// ========== CONSTRUCTOR ==========
+
+ArnesBenchmark::ArnesBenchmark()
+    : tiempoMinimo(0.5) {
+}
+
+// ========== REGISTRO ==========
+
+void ArnesBenchmark::agregar(const QString& nombre, FuncionBenchmark funcion) {
+    benchmarks.push_back({nombre, funcion, 0});
+}
+
+void ArnesBenchmark::agregar(const QString& nombre, FuncionBenchmark funcion, const std::vector<int>& argumentos) {
+    for (int argumento : argumentos) {
+        benchmarks.push_back({nombre + "/" + QString::number(argumento), funcion, argumento});
+    }
+}
+
+// ========== EJECUCION ==========
+
+ResultadoBenchmark ArnesBenchmark::correr(const Benchmark& benchmark) const {
+    long long iteraciones = 1;
+
+    while (true) {
+        EstadoBenchmark estado(iteraciones, benchmark.argumento);
+        benchmark.funcion(estado);
+
+        double segundos = estado.getSegundosReales();
+        bool suficiente = segundos >= tiempoMinimo || iteraciones >= 1000000000LL;
+
+        if (suficiente) {
+            ResultadoBenchmark resultado;
+            resultado.nombre = benchmark.nombre;
+            resultado.iteraciones = iteraciones;
+            resultado.tiempoReal = segundos * 1.0e9 / iteraciones;
+            resultado.tiempoCPU = estado.getSegundosCPU() * 1.0e9 / iteraciones;
+            if (estado.getElementosProcesados() > 0 && segundos > 0.0) {
+                resultado.elementosPorSegundo = estado.getElementosProcesados() / segundos;
+            }
+            resultado.contadores = estado.getContadores();
+            return resultado;
+        }
+
+        // Estimar cuantas iteraciones llenan el tiempo minimo (con margen),
+        // sin crecer mas de 10x de una vez
+        double multiplicador = segundos > 0.0 ? 1.4 * tiempoMinimo / segundos : 10.0;
+        multiplicador = std::min(std::max(multiplicador, 1.0), 10.0);
+        iteraciones = std::max(iteraciones + 1, static_cast<long long>(iteraciones * multiplicador));
+    }
+}
+
+std::vector<ResultadoBenchmark> ArnesBenchmark::ejecutar(QTextStream* progreso) {
+    std::vector<ResultadoBenchmark> resultados;
+
+    for (const auto& benchmark : benchmarks) {
+        if (!filtro.isEmpty() && !benchmark.nombre.contains(filtro)) continue;
+
+        ResultadoBenchmark r = correr(benchmark);
+        resultados.push_back(r);
+
+        if (progreso) {
+            QString linea = QString("%1 %2 ns %3 ns %4")
+                                .arg(r.nombre, -40)
+                                .arg(r.tiempoReal, 14, 'f', 1)
+                                .arg(r.tiempoCPU, 14, 'f', 1)
+                                .arg(r.iteraciones, 12);
+            if (r.elementosPorSegundo > 0.0) {
+                linea += QString("  %1 M elem/s").arg(r.elementosPorSegundo / 1.0e6, 0, 'f', 2);
+            }
+            for (const auto& contador : r.contadores) {
+                linea += QString("  %1=%2").arg(contador.first).arg(contador.second, 0, 'g', 4);
+            }
+
+            *progreso << linea << "\n";
+            progreso->flush();
+        }
+    }
+
+    return resultados;
+}
+
+QStringList ArnesBenchmark::getNombres() const {
+    QStringList nombres;
+    for (const auto& benchmark : benchmarks) {
+        nombres << benchmark.nombre;
+    }
+    return nombres;
+}
+
+// ========== SALIDA ==========
+
+bool ArnesBenchmark::escribirJSON(const std::vector<ResultadoBenchmark>& resultados, const QString& ruta) {
+    QJsonObject contexto;
+    contexto.insert("date", QDateTime::currentDateTime().toString(Qt::ISODate));
+    contexto.insert("executable", QCoreApplication::applicationFilePath());
+    contexto.insert("num_cpus", static_cast<int>(std::thread::hardware_concurrency()));
+#ifdef QT_NO_DEBUG
+    contexto.insert("library_build_type", "release");
+#else
+    contexto.insert("library_build_type", "debug");
+#endif
+    contexto.insert("simd", FisicaVortice::getInstruccionesLote());
+
+    QJsonArray lista;
+    for (const auto& r : resultados) {
+        QJsonObject benchmark;
+        benchmark.insert("name", r.nombre);
+        benchmark.insert("run_name", r.nombre);
+        benchmark.insert("run_type", "iteration");
+        benchmark.insert("iterations", static_cast<qint64>(r.iteraciones));
+        benchmark.insert("real_time", r.tiempoReal);
+        benchmark.insert("cpu_time", r.tiempoCPU);
+        benchmark.insert("time_unit", "ns");
+        if (r.elementosPorSegundo > 0.0) {
+            benchmark.insert("items_per_second", r.elementosPorSegundo);
+        }
+        for (const auto& contador : r.contadores) {
+            benchmark.insert(contador.first, contador.second);
+        }
+        lista.append(benchmark);
+    }
+
+    QJsonObject raiz;
+    raiz.insert("context", contexto);
+    raiz.insert("benchmarks", lista);
+
+    QFile archivo;
+    bool abierto = false;
+
+    if (ruta == "-") {
+        abierto = archivo.open(stdout, QIODevice::WriteOnly);
+    } else {
+        archivo.setFileName(ruta);
+        abierto = archivo.open(QIODevice::WriteOnly);
+    }
+
+    if (!abierto) {
+        qWarning() << "No se pudo escribir el JSON:" << ruta;
+        return false;
+    }
+
+    archivo.write(QJsonDocument(raiz).toJson(QJsonDocument::Indented));
+    return true;
+}
+
+// ========== CONFIGURACION ==========
+
+void ArnesBenchmark::setTiempoMinimo(double segundos) {
+    if (segundos > 0.0) {
+        tiempoMinimo = segundos;
+    }
+}
+
+void ArnesBenchmark::setFiltro(const QString& texto) {
+    filtro = texto;
+}
@@ -0,0 +1,128 @@
+#ifndef ARNESBENCHMARK_H
+#define ARNESBENCHMARK_H
+
+#include <QString>
+#include <QStringList>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <vector>
+#include <utility>
+#include <ctime>
+
+// Evita que el compilador descarte un calculo cuyo resultado no se usa
+template <typename T>
+inline void noOptimizar(const T& valor) {
+#if defined(__clang__)
+    asm volatile("" : : "g"(valor) : "memory");
+#elif defined(__GNUC__)
+    asm volatile("" : : "r,m"(valor) : "memory");
+#else
+    const volatile T* sumidero = &valor;
+    (void)sumidero;
+#endif
+}
+
+// Estado de una corrida de un benchmark (estilo Google Benchmark):
+//   void miBenchmark(EstadoBenchmark& estado) {
+//       ... preparar ...
+//       while (estado.continuar()) { ... lo que se mide ... }
+//       estado.setElementosProcesados(estado.getIteraciones() * n);
+//   }
+// El arnes decide cuantas iteraciones hacen falta.
+class EstadoBenchmark {
+private:
+    long long iteraciones;          // Objetivo de esta corrida
+    long long restantes;
+    int argumento;
+    bool iniciado;
+
+    QElapsedTimer reloj;
+    qint64 nsMedidos;               // Tiempo real sin las pausas
+    std::clock_t cpuInicio;
+    double cpuMedido;               // Segundos de CPU sin las pausas
+
+    long long elementosProcesados;
+    std::vector<std::pair<QString, double>> contadores;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    EstadoBenchmark(long long iteraciones, int argumento);
+
+    // ========== BUCLE ==========
+    bool continuar();               // true mientras queden iteraciones
+    void pausarReloj();             // Excluir trabajo de preparacion
+    void reanudarReloj();
+
+    // ========== DATOS DEL BENCHMARK ==========
+    int getArgumento() const { return argumento; }
+    long long getIteraciones() const { return iteraciones; }
+    void setElementosProcesados(long long n) { elementosProcesados = n; }
+    void setContador(const QString& nombre, double valor);
+
+    // ========== RESULTADOS (para el arnes) ==========
+    double getSegundosReales() const { return nsMedidos / 1.0e9; }
+    double getSegundosCPU() const { return cpuMedido; }
+    long long getElementosProcesados() const { return elementosProcesados; }
+    const std::vector<std::pair<QString, double>>& getContadores() const { return contadores; }
+};
+
+typedef void (*FuncionBenchmark)(EstadoBenchmark& estado);
+
+// Resultado de un benchmark (tiempos en nanosegundos por iteracion)
+struct ResultadoBenchmark {
+    QString nombre;
+    long long iteraciones;
+    double tiempoReal;
+    double tiempoCPU;
+    double elementosPorSegundo;     // 0 si el benchmark no los reporta
+    std::vector<std::pair<QString, double>> contadores;
+
+    ResultadoBenchmark()
+        : iteraciones(0), tiempoReal(0.0), tiempoCPU(0.0), elementosPorSegundo(0.0) {}
+};
+
+// Registro y ejecucion de benchmarks
+// Cada benchmark se repite con mas iteraciones hasta que una corrida
+// dure al menos tiempoMinimo; esa corrida es la que se reporta.
+class ArnesBenchmark {
+private:
+    struct Benchmark {
+        QString nombre;
+        FuncionBenchmark funcion;
+        int argumento;              // 0 si no tiene
+    };
+
+    std::vector<Benchmark> benchmarks;
+    double tiempoMinimo;            // Segundos por benchmark (0.5)
+    QString filtro;                 // Solo los nombres que lo contienen
+
+    ResultadoBenchmark correr(const Benchmark& benchmark) const;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    ArnesBenchmark();
+
+    // ========== REGISTRO ==========
+    // Un benchmark por argumento: "nombre/100", "nombre/1000", ...
+    void agregar(const QString& nombre, FuncionBenchmark funcion);
+    void agregar(const QString& nombre, FuncionBenchmark funcion, const std::vector<int>& argumentos);
+
+    // ========== EJECUCION ==========
+    // Escribe una linea por benchmark en 'progreso' (si no es nullptr)
+    std::vector<ResultadoBenchmark> ejecutar(QTextStream* progreso);
+    QStringList getNombres() const;
+
+    // ========== SALIDA ==========
+    // Formato de Google Benchmark (context + benchmarks); ruta "-" = salida estandar
+    static bool escribirJSON(const std::vector<ResultadoBenchmark>& resultados, const QString& ruta);
+
+    // ========== CONFIGURACION ==========
+    void setTiempoMinimo(double segundos);
+    void setFiltro(const QString& texto);
+};
+
+// Definidos en microbenchmarks.cpp y macrobenchmarks.cpp
+void registrarMicrobenchmarks(ArnesBenchmark& arnes);
+void registrarMacrobenchmarks(ArnesBenchmark& arnes);
+
+#endif // ARNESBENCHMARK_H
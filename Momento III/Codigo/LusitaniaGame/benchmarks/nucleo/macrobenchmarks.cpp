@@ -0,0 +1,101 @@
+#include "arnesbenchmark.h"
+#include "lotedibujo.h"
+#include "motorjuego.h"
+#include "simuladorheadless.h"
+#include <QImage>
+#include <QPainter>
+
+// ========== MACROBENCHMARKS ==========
+// Cada iteracion juega un nivel completo sin ventana durante un tiempo
+// simulado fijo, con la entrada aleatoria del simulador headless.
+// Siempre el mismo episodio (misma semilla): mismo trabajo por iteracion.
+
+namespace {
+
+const float SEGUNDOS_SIMULADOS = 30.0f;
+
+void nivelHeadless(EstadoBenchmark& estado) {
+    SimuladorHeadless simulador(estado.getArgumento());
+    simulador.setDuracionMaxima(SEGUNDOS_SIMULADOS);
+    simulador.setModoEntrada(ModoEntrada::ALEATORIA);
+    simulador.setSemilla(1);
+
+    ResultadoEpisodio resultado;
+    long long pasos = 0;
+
+    while (estado.continuar()) {
+        resultado = simulador.ejecutarEpisodio(0);
+        pasos += resultado.pasos;
+    }
+
+    // Un episodio puede terminar antes (victoria o derrota): reportar lo simulado
+    estado.setElementosProcesados(pasos);
+    estado.setContador("pasos", resultado.pasos);
+    estado.setContador("segundos_simulados", resultado.tiempoSimulado);
+    if (resultado.tiempoReal > 0.0) {
+        estado.setContador("x_tiempo_real", resultado.tiempoSimulado / resultado.tiempoReal);
+    }
+}
+
+// ===== RENDER =====
+// Un frame del nivel despues de unos segundos de juego (escombros,
+// torpedos y vortices ya en pantalla): QPainter raster con
+// antialiasing, como el backend por defecto, contra grabar el lote del
+// backend OpenGL. El lote mide solo la CPU; el dibujo lo hace la GPU.
+
+const float SEGUNDOS_PREVIOS = 10.0f;
+
+Nivel* nivelEnJuego(int numeroNivel) {
+    Nivel* nivel = MotorJuego::crearNivel(numeroNivel, 1);
+    if (!nivel) return nullptr;
+
+    const float paso = 1.0f / 60.0f;
+    for (float t = 0.0f; t < SEGUNDOS_PREVIOS; t += paso) {
+        nivel->aplicarEntrada(EntradaJugador(), paso);
+        nivel->actualizar(paso);
+    }
+    return nivel;
+}
+
+void renderQPainter(EstadoBenchmark& estado) {
+    Nivel* nivel = nivelEnJuego(estado.getArgumento());
+    if (!nivel) return;
+
+    QImage imagen(800, 600, QImage::Format_ARGB32_Premultiplied);
+
+    while (estado.continuar()) {
+        QPainter painter(&imagen);
+        painter.setRenderHint(QPainter::Antialiasing);
+        nivel->renderizar(painter);
+    }
+
+    delete nivel;
+}
+
+void renderLote(EstadoBenchmark& estado) {
+    Nivel* nivel = nivelEnJuego(estado.getArgumento());
+    if (!nivel) return;
+
+    LoteDibujo lote;
+
+    while (estado.continuar()) {
+        lote.iniciar(QSize(800, 600), 1.0);
+        QPainter painter(&lote);
+        painter.setRenderHint(QPainter::Antialiasing);
+        nivel->renderizar(painter);
+    }
+
+    estado.setContador("instancias", lote.getNumInstancias());
+    estado.setContador("llamadas", static_cast<double>(lote.getTramos().size()));
+    estado.setContador("diferidos", static_cast<double>(lote.getDiferidos().size()));
+
+    delete nivel;
+}
+
+} // namespace
+
+void registrarMacrobenchmarks(ArnesBenchmark& arnes) {
+    arnes.agregar("nivel", nivelHeadless, {1, 2, 3});
+    arnes.agregar("render_qpainter", renderQPainter, {1, 2, 3});
+    arnes.agregar("render_lote", renderLote, {1, 2, 3});
+}
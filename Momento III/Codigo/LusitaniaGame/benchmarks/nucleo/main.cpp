@@ -0,0 +1,77 @@
+#include "arnesbenchmark.h"
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QLoggingCategory>
+#include <QTextStream>
+#include <cstdio>
+
+// ========== LUSITANIA BENCHMARKS ==========
+// Micro (Vector2D, colisiones, componentes de fisica, IA) y macro
+// (niveles completos sin ventana y un frame de render por backend).
+// Con --json escribe los resultados en el formato de Google Benchmark
+// para comparar entre versiones.
+
+int main(int argc, char *argv[]) {
+    // Los niveles crean QPixmap: plataforma offscreen, como lusitania_headless
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("lusitania_benchmarks");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks del nucleo de El Naufragio del Lusitania");
+    parser.addHelpOption();
+
+    QCommandLineOption opcionFiltro("filtro", "Solo benchmarks cuyo nombre contiene el texto.", "texto");
+    QCommandLineOption opcionTiempo("tiempo-minimo", "Segundos minimos por benchmark.", "s", "0.5");
+    QCommandLineOption opcionJSON("json", "Archivo JSON con los resultados ('-' = salida estandar).", "archivo");
+    QCommandLineOption opcionLista("lista", "Listar los benchmarks sin correrlos.");
+
+    parser.addOption(opcionFiltro);
+    parser.addOption(opcionTiempo);
+    parser.addOption(opcionJSON);
+    parser.addOption(opcionLista);
+    parser.process(app);
+
+    QLoggingCategory::setFilterRules("default.debug=false");
+
+    ArnesBenchmark arnes;
+    registrarMicrobenchmarks(arnes);
+    registrarMacrobenchmarks(arnes);
+
+    arnes.setFiltro(parser.value(opcionFiltro));
+    arnes.setTiempoMinimo(parser.value(opcionTiempo).toDouble());
+
+    QTextStream salida(stdout);
+
+    if (parser.isSet(opcionLista)) {
+        for (const QString& nombre : arnes.getNombres()) {
+            salida << nombre << "\n";
+        }
+        return 0;
+    }
+
+    // Con el JSON en la salida estandar, la tabla va a stderr
+    QString rutaJSON = parser.value(opcionJSON);
+    QTextStream errores(stderr);
+    QTextStream& progreso = (rutaJSON == "-") ? errores : salida;
+
+    progreso << QString("%1 %2    %3    %4")
+                    .arg("Benchmark", -40)
+                    .arg("Tiempo", 14)
+                    .arg("CPU", 14)
+                    .arg("Iteraciones", 12)
+             << "\n";
+
+    std::vector<ResultadoBenchmark> resultados = arnes.ejecutar(&progreso);
+
+    if (!rutaJSON.isEmpty()) {
+        if (!ArnesBenchmark::escribirJSON(resultados, rutaJSON)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
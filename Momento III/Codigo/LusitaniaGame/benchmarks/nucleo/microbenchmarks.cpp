@@ -0,0 +1,379 @@
+#include "arnesbenchmark.h"
+#include "vector2d.h"
+#include "tipos.h"
+#include "escombro.h"
+#include "motorfisica.h"
+#include "registroentidades.h"
+#include "fisicavortice.h"
+#include "fisicaflotacion.h"
+#include "trayectoriaparabolica.h"
+#include "movimientocircular.h"
+#include "osciladorarmonico.h"
+#include "sistemarazonamiento.h"
+#include "generadoraleatorio.h"
+#include <cmath>
+#include <vector>
+
+// ========== MICROBENCHMARKS ==========
+// Operaciones sueltas del nucleo. Los datos salen de un generador con
+// semilla fija: todas las corridas miden exactamente el mismo trabajo.
+
+namespace {
+
+const int CANTIDAD = 1024;          // Elementos por iteracion
+const float DT = 1.0f / 60.0f;
+const uint64_t SEMILLA = 12345;
+
+std::vector<Vector2D> vectoresAleatorios(GeneradorAleatorio& gen, int n, float rango) {
+    std::vector<Vector2D> vectores;
+    vectores.reserve(n);
+    for (int i = 0; i < n; i++) {
+        vectores.emplace_back(gen.real(-rango, rango), gen.real(-rango, rango));
+    }
+    return vectores;
+}
+
+// Escombros neutros alrededor de (0, 0), dentro de un radio
+std::vector<Entidad*> escombrosAlrededor(GeneradorAleatorio& gen, int n, float radio) {
+    std::vector<Entidad*> entidades;
+    entidades.reserve(n);
+    for (int i = 0; i < n; i++) {
+        Escombro* e = new Escombro(Vector2D(gen.real(-radio, radio), gen.real(-radio, radio)),
+                                   TipoEscombro::NEUTRO);
+        e->setVelocidad(Vector2D(gen.real(-50.0f, 50.0f), gen.real(-50.0f, 50.0f)));
+        entidades.push_back(e);
+    }
+    return entidades;
+}
+
+void liberar(std::vector<Entidad*>& entidades) {
+    for (auto* e : entidades) delete e;
+    entidades.clear();
+}
+
+// ===== VECTOR2D =====
+
+void vectorSuma(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Vector2D> a = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+    std::vector<Vector2D> b = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+    std::vector<Vector2D> r(CANTIDAD);
+
+    while (estado.continuar()) {
+        for (int i = 0; i < CANTIDAD; i++) {
+            r[i] = a[i] + b[i] * 0.5f;
+        }
+        noOptimizar(r.data());
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+void vectorNormalizado(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Vector2D> a = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+    std::vector<Vector2D> r(CANTIDAD);
+
+    while (estado.continuar()) {
+        for (int i = 0; i < CANTIDAD; i++) {
+            r[i] = a[i].normalizado();
+        }
+        noOptimizar(r.data());
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+void vectorDistancia(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Vector2D> a = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+    std::vector<Vector2D> b = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+
+    while (estado.continuar()) {
+        float suma = 0.0f;
+        for (int i = 0; i < CANTIDAD; i++) {
+            suma += a[i].distanciaA(b[i]);
+        }
+        noOptimizar(suma);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+void vectorProductoEscalar(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Vector2D> a = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+    std::vector<Vector2D> b = vectoresAleatorios(gen, CANTIDAD, 1000.0f);
+
+    while (estado.continuar()) {
+        float suma = 0.0f;
+        for (int i = 0; i < CANTIDAD; i++) {
+            suma += a[i].productoEscalar(b[i]);
+        }
+        noOptimizar(suma);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+// ===== CAJACOLISION =====
+
+void cajaColisiona(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<CajaColision> cajas;
+    cajas.reserve(CANTIDAD);
+    for (int i = 0; i < CANTIDAD; i++) {
+        // Zona chica: cerca de la mitad de los pares se tocan
+        cajas.emplace_back(gen.real(0.0f, 200.0f), gen.real(0.0f, 200.0f),
+                           gen.real(10.0f, 60.0f), gen.real(10.0f, 60.0f));
+    }
+
+    while (estado.continuar()) {
+        int choques = 0;
+        for (int i = 0; i < CANTIDAD; i++) {
+            choques += cajas[i].colisionaCon(cajas[(i * 7 + 1) % CANTIDAD]) ? 1 : 0;
+        }
+        noOptimizar(choques);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+// ===== MOTORFISICA =====
+
+// N escombros con densidad constante (~1 vecino por celda), para que
+// el costo refleje la cantidad y no lo apretado del mundo
+void prepararMotor(MotorFisica& motor, int n, bool grid) {
+    GeneradorAleatorio gen(SEMILLA);
+    float lado = std::sqrt(static_cast<float>(n)) * 80.0f;
+
+    motor.setDimensionesMundo(lado, lado);
+    motor.setBroadphaseActiva(grid);
+
+    for (int i = 0; i < n; i++) {
+        motor.agregarEntidad(new Escombro(Vector2D(gen.real(0.0f, lado), gen.real(0.0f, lado)),
+                                          TipoEscombro::NEUTRO));
+    }
+
+    // Un primer paso separa las cajas que nacieron encimadas
+    motor.verificarColisiones();
+}
+
+void colisionesGrid(EstadoBenchmark& estado) {
+    MotorFisica motor;
+    prepararMotor(motor, estado.getArgumento(), true);
+
+    while (estado.continuar()) {
+        motor.verificarColisiones();
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * estado.getArgumento());
+}
+
+void colisionesFuerzaBruta(EstadoBenchmark& estado) {
+    MotorFisica motor;
+    prepararMotor(motor, estado.getArgumento(), false);
+
+    while (estado.continuar()) {
+        motor.verificarColisiones();
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * estado.getArgumento());
+}
+
+// Entidad minima: solo lleva el componente de fisica
+class CuerpoFisico : public Entidad {
+public:
+    CuerpoFisico(const Vector2D& pos) : Entidad(pos, TipoEntidad::ESCOMBRO) {}
+    void actualizar(float dt) override { (void)dt; }
+    void renderizar(QPainter& painter) override { (void)painter; }
+};
+
+// Los cinco componentes mezclados al azar, como quedan en el arreglo
+// cuando se crean en el orden del juego
+void prepararMezclaFisica(MotorFisica& motor, int n, bool lotes) {
+    GeneradorAleatorio gen(SEMILLA);
+    motor.setDespachoPorLotes(lotes);
+
+    for (int i = 0; i < n; i++) {
+        Vector2D pos(gen.real(0.0f, 2000.0f), gen.real(0.0f, 1200.0f));
+        CuerpoFisico* cuerpo = new CuerpoFisico(pos);
+
+        switch (gen.entero(5)) {
+        case 0: cuerpo->setFisica(new FisicaFlotacion(gen.real(0.3f, 7.8f))); break;
+        case 1: cuerpo->setFisica(new FisicaVortice(pos + Vector2D(40.0f, 0.0f), 150.0f, 0.15f)); break;
+        case 2: cuerpo->setFisica(new TrayectoriaParabolica(gen.real(100.0f, 300.0f), -80.0f, 50.0f)); break;
+        case 3: cuerpo->setFisica(new MovimientoCircular(40.0f, 0.5f, pos)); break;
+        default: cuerpo->setFisica(new OsciladorArmonico()); break;
+        }
+        motor.agregarEntidad(cuerpo);
+    }
+}
+
+void fisicaVirtual(EstadoBenchmark& estado) {
+    MotorFisica motor;
+    prepararMezclaFisica(motor, estado.getArgumento(), false);
+
+    while (estado.continuar()) {
+        motor.aplicarFisica(DT);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * estado.getArgumento());
+}
+
+void fisicaLotes(EstadoBenchmark& estado) {
+    MotorFisica motor;
+    prepararMezclaFisica(motor, estado.getArgumento(), true);
+
+    while (estado.continuar()) {
+        motor.aplicarFisica(DT);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * estado.getArgumento());
+}
+
+// ===== REGISTRO DE ENTIDADES =====
+
+// Muere la mitad de golpe (una explosion, un cambio de oleada): la
+// compactacion tiene que seguir siendo lineal
+void registroCompactar(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    RegistroEntidades registro;
+    int n = estado.getArgumento();
+
+    while (estado.continuar()) {
+        estado.pausarReloj();
+        for (int i = 0; i < n; i++) {
+            Entidad* e = new Escombro(Vector2D(0, 0), TipoEscombro::NEUTRO);
+            registro.agregar(e);
+            e->setActivo(gen.entero(2) == 0);
+        }
+        estado.reanudarReloj();
+
+        registro.compactar();
+
+        estado.pausarReloj();
+        registro.limpiar();
+        estado.reanudarReloj();
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * n);
+}
+
+void registroObtener(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    RegistroEntidades registro;
+    std::vector<HandleEntidad> handles;
+
+    for (int i = 0; i < CANTIDAD; i++) {
+        handles.push_back(registro.agregar(new Escombro(Vector2D(0, 0), TipoEscombro::NEUTRO)));
+    }
+    // La mitad de los handles quedan viejos (ranuras ya reutilizadas)
+    for (int i = 0; i < CANTIDAD; i += 2) {
+        registro.retirar(handles[i]);
+    }
+    registro.compactar();
+    for (int i = 0; i < CANTIDAD / 2; i++) {
+        registro.agregar(new Escombro(Vector2D(0, 0), TipoEscombro::NEUTRO));
+    }
+
+    while (estado.continuar()) {
+        int validos = 0;
+        for (const auto& h : handles) {
+            validos += registro.obtener(h) ? 1 : 0;
+        }
+        noOptimizar(validos);
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+// ===== COMPONENTES DE FISICA =====
+
+void vorticeCalcular(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Entidad*> entidades = escombrosAlrededor(gen, CANTIDAD, 200.0f);
+    FisicaVortice vortice(Vector2D(0, 0), 150.0f, 0.15f);
+
+    while (estado.continuar()) {
+        for (auto* e : entidades) {
+            Vector2D p = vortice.calcular(e, DT);
+            noOptimizar(p);
+        }
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+    liberar(entidades);
+}
+
+void vorticeLote(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<float> px, py, vx, vy;
+    for (int i = 0; i < CANTIDAD; i++) {
+        px.push_back(gen.real(-200.0f, 200.0f));
+        py.push_back(gen.real(-200.0f, 200.0f));
+        vx.push_back(0.0f);
+        vy.push_back(0.0f);
+    }
+    FisicaVortice vortice(Vector2D(0, 0), 150.0f, 0.15f);
+
+    while (estado.continuar()) {
+        vortice.aplicarLote(px.data(), py.data(), vx.data(), vy.data(), CANTIDAD, DT);
+        noOptimizar(vx.data());
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+}
+
+void flotacionCalcular(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    std::vector<Entidad*> entidades = escombrosAlrededor(gen, CANTIDAD, 200.0f);
+    FisicaFlotacion flotacion(0.6f);
+
+    while (estado.continuar()) {
+        for (auto* e : entidades) {
+            Vector2D p = flotacion.calcular(e, DT);
+            noOptimizar(p);
+        }
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * CANTIDAD);
+    liberar(entidades);
+}
+
+// ===== IA =====
+
+void razonamientoDecidir(EstadoBenchmark& estado) {
+    GeneradorAleatorio gen(SEMILLA);
+    SistemaRazonamiento razonamiento(PerfilIA(), &gen);
+
+    // Percepciones variadas: sin objetivo, lejos, a distancia de ataque, encima
+    std::vector<DatosPercepcion> percepciones(256);
+    for (auto& p : percepciones) {
+        p.objetivoDetectado = gen.entero(4) != 0;
+        p.posicionObjetivo = Vector2D(gen.real(-400.0f, 400.0f), gen.real(-400.0f, 400.0f));
+        p.velocidadObjetivo = Vector2D(gen.real(-100.0f, 100.0f), gen.real(-100.0f, 100.0f));
+        p.distanciaObjetivo = p.posicionObjetivo.magnitud();
+        p.posicionAnterior = p.posicionObjetivo - p.velocidadObjetivo * DT;
+    }
+    Vector2D posicionAgente(0, 0);
+
+    while (estado.continuar()) {
+        for (const auto& p : percepciones) {
+            PlanAccion plan = razonamiento.decidir(p, posicionAgente);
+            noOptimizar(plan);
+        }
+    }
+    estado.setElementosProcesados(estado.getIteraciones() * static_cast<long long>(percepciones.size()));
+}
+
+} // namespace
+
+void registrarMicrobenchmarks(ArnesBenchmark& arnes) {
+    arnes.agregar("vector2d/suma", vectorSuma);
+    arnes.agregar("vector2d/normalizado", vectorNormalizado);
+    arnes.agregar("vector2d/distancia", vectorDistancia);
+    arnes.agregar("vector2d/producto_escalar", vectorProductoEscalar);
+
+    arnes.agregar("cajacolision/colisiona", cajaColisiona);
+
+    arnes.agregar("motorfisica/colisiones_grid", colisionesGrid, {100, 1000, 10000});
+    arnes.agregar("motorfisica/colisiones_fuerza_bruta", colisionesFuerzaBruta, {100, 1000, 10000});
+    arnes.agregar("motorfisica/fisica_virtual", fisicaVirtual, {1000, 10000, 100000});
+    arnes.agregar("motorfisica/fisica_lotes", fisicaLotes, {1000, 10000, 100000});
+
+    arnes.agregar("registroentidades/compactar", registroCompactar, {1000, 10000, 100000});
+    arnes.agregar("registroentidades/obtener", registroObtener);
+
+    arnes.agregar("fisicavortice/calcular", vorticeCalcular);
+    arnes.agregar("fisicavortice/aplicar_lote", vorticeLote);
+    arnes.agregar("fisicaflotacion/calcular", flotacionCalcular);
+
+    arnes.agregar("sistemarazonamiento/decidir", razonamientoDecidir);
+}
@@ -0,0 +1,22 @@
+# Benchmarks del nucleo: micro (Vector2D, colisiones, fisica, IA) y
+# macro (niveles completos sin ventana). Resultados en JSON.
+# Uso: lusitania_benchmarks --json resultados.json [--filtro colisiones]
+
+QT       += core gui
+QT       -= widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = lusitania_benchmarks
+
+include(../../nucleo.pri)
+
+SOURCES += \
+    arnesbenchmark.cpp \
+    macrobenchmarks.cpp \
+    main.cpp \
+    microbenchmarks.cpp
+
+HEADERS += \
+    arnesbenchmark.h
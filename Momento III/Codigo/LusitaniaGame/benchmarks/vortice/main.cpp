@@ -0,0 +1,207 @@
+#include "vortice.h"
+#include "escombro.h"
+#include "fisicavortice.h"
+#include "campovortices.h"
+#include "generadoraleatorio.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QTextStream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ========== BENCHMARK DE VORTICES ==========
+// Compara tres formas de aplicar V vortices a D escombros:
+//   por entidad  - Vortice::aplicarFuerzaA sobre cada Escombro (Entidad*)
+//   lote escalar - FisicaVortice::aplicarCampoLoteEscalar sobre arreglos
+//   lote SIMD    - FisicaVortice::aplicarCampoLote (AVX o SSE2)
+//   campo        - CampoVortices: grilla de 32 px armada en cada llamada
+//                  y una lectura bilineal por escombro
+// Las cuatro calculan la misma fuerza (la de Nivel 3: radial, 500, rango
+// de atraccion del vortice); el campo la aproxima. Reporta nanosegundos
+// por par vortice-escombro.
+
+namespace {
+
+const float DT = 1.0f / 60.0f;
+const float FUERZA_NIVEL3 = 500.0f;     // La de Vortice::aplicarFuerzaA
+
+struct Escenario {
+    std::vector<Vortice*> vortices;
+    std::vector<Escombro*> entidades;
+    std::vector<float> posX, posY, velX, velY;
+    CampoVortices campoVortices;
+
+    Escenario(int numVortices, int numEscombros, uint64_t semilla) {
+        GeneradorAleatorio gen(semilla);
+
+        // Vortices en una zona de 1200x800; los escombros en la misma zona,
+        // asi una buena parte cae dentro de algun rango de atraccion
+        for (int v = 0; v < numVortices; v++) {
+            Vector2D centro(gen.real(0.0f, 1200.0f), gen.real(0.0f, 800.0f));
+            vortices.push_back(new Vortice(centro, 120.0f, 15.0f, &gen));
+        }
+
+        for (int i = 0; i < numEscombros; i++) {
+            Vector2D pos(gen.real(0.0f, 1200.0f), gen.real(0.0f, 800.0f));
+            entidades.push_back(new Escombro(pos, TipoEscombro::NEUTRO));
+            posX.push_back(pos.x);
+            posY.push_back(pos.y);
+        }
+
+        reiniciarVelocidades();
+    }
+
+    ~Escenario() {
+        for (auto* e : entidades) delete e;
+        for (auto* v : vortices) delete v;
+    }
+
+    void reiniciarVelocidades() {
+        velX.assign(posX.size(), 0.0f);
+        velY.assign(posY.size(), 0.0f);
+        for (auto* e : entidades) {
+            e->setVelocidad(Vector2D(0, 0));
+        }
+    }
+
+    void porEntidad() {
+        for (auto* v : vortices) {
+            for (auto* e : entidades) {
+                v->aplicarFuerzaA(e, DT);
+            }
+        }
+    }
+
+    void loteEscalar() {
+        for (auto* v : vortices) {
+            FisicaVortice::aplicarCampoLoteEscalar(v->getPosicion(), v->getRangoAtraccion(), FUERZA_NIVEL3, 0.0f,
+                                                   posX.data(), posY.data(), velX.data(), velY.data(),
+                                                   posX.size(), DT);
+        }
+    }
+
+    void campo() {
+        campoVortices.limpiar();
+        for (auto* v : vortices) {
+            campoVortices.agregarVortice(v->getPosicion(), v->getRangoAtraccion(), FUERZA_NIVEL3);
+        }
+        campoVortices.construir();
+        campoVortices.aplicarLote(posX.data(), posY.data(), velX.data(), velY.data(), posX.size(), DT);
+    }
+
+    void loteSIMD() {
+        for (auto* v : vortices) {
+            FisicaVortice::aplicarCampoLote(v->getPosicion(), v->getRangoAtraccion(), FUERZA_NIVEL3, 0.0f,
+                                            posX.data(), posY.data(), velX.data(), velY.data(),
+                                            posX.size(), DT);
+        }
+    }
+};
+
+// Repite la funcion hasta juntar ~0.2 s; devuelve ns por par vortice-escombro
+template <typename Funcion>
+double medir(Funcion funcion, size_t pares) {
+    funcion();  // Calentar caches
+
+    QElapsedTimer reloj;
+    reloj.start();
+
+    long long repeticiones = 0;
+    while (reloj.nsecsElapsed() < 200000000LL) {
+        funcion();
+        repeticiones++;
+    }
+
+    return static_cast<double>(reloj.nsecsElapsed()) / (static_cast<double>(repeticiones) * pares);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("lusitania_bench_vortice");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark de fuerzas de vortice: por entidad, lote escalar y lote SIMD");
+    parser.addHelpOption();
+
+    QCommandLineOption opcionEscombros("escombros", "Cantidades de escombros separadas por comas.", "lista", "256,4096,65536");
+    QCommandLineOption opcionVortices("vortices", "Vortices activos.", "n", "5");
+    QCommandLineOption opcionSemilla("semilla", "Semilla de las posiciones.", "n", "1");
+
+    parser.addOption(opcionEscombros);
+    parser.addOption(opcionVortices);
+    parser.addOption(opcionSemilla);
+    parser.process(app);
+
+    int numVortices = qMax(1, parser.value(opcionVortices).toInt());
+    uint64_t semilla = parser.value(opcionSemilla).toULongLong();
+
+    QTextStream salida(stdout);
+    salida << "Lote SIMD: " << FisicaVortice::getInstruccionesLote()
+           << "  |  vortices: " << numVortices << "\n\n";
+    salida << qSetFieldWidth(10) << "escombros"
+           << qSetFieldWidth(14) << "entidad ns"
+           << qSetFieldWidth(14) << "escalar ns"
+           << qSetFieldWidth(14) << "SIMD ns"
+           << qSetFieldWidth(14) << "campo ns"
+           << qSetFieldWidth(12) << "x entidad"
+           << qSetFieldWidth(12) << "x escalar"
+           << qSetFieldWidth(14) << "dif. max"
+           << qSetFieldWidth(14) << "dif. campo"
+           << qSetFieldWidth(0) << "\n";
+
+    const QStringList cantidades = parser.value(opcionEscombros).split(',', Qt::SkipEmptyParts);
+    for (const QString& texto : cantidades) {
+        int numEscombros = qMax(1, texto.trimmed().toInt());
+        Escenario escenario(numVortices, numEscombros, semilla);
+        size_t pares = static_cast<size_t>(numVortices) * numEscombros;
+
+        // ===== COMPROBACION: un paso de cada ruta desde velocidad cero =====
+        escenario.reiniciarVelocidades();
+        escenario.porEntidad();
+        escenario.loteSIMD();
+
+        float diferencia = 0.0f;
+        for (size_t i = 0; i < escenario.entidades.size(); i++) {
+            Vector2D v = escenario.entidades[i]->getVelocidad();
+            diferencia = std::max(diferencia, std::fabs(v.x - escenario.velX[i]));
+            diferencia = std::max(diferencia, std::fabs(v.y - escenario.velY[i]));
+        }
+
+        // El campo contra el calculo exacto (velocidad ganada en un paso)
+        std::vector<float> exactaX = escenario.velX;
+        std::vector<float> exactaY = escenario.velY;
+        escenario.velX.assign(exactaX.size(), 0.0f);
+        escenario.velY.assign(exactaY.size(), 0.0f);
+        escenario.campo();
+
+        float diferenciaCampo = 0.0f;
+        for (size_t i = 0; i < exactaX.size(); i++) {
+            diferenciaCampo = std::max(diferenciaCampo, std::fabs(exactaX[i] - escenario.velX[i]));
+            diferenciaCampo = std::max(diferenciaCampo, std::fabs(exactaY[i] - escenario.velY[i]));
+        }
+
+        // ===== TIEMPOS =====
+        double nsEntidad = medir([&]() { escenario.porEntidad(); }, pares);
+        double nsEscalar = medir([&]() { escenario.loteEscalar(); }, pares);
+        double nsSIMD = medir([&]() { escenario.loteSIMD(); }, pares);
+        double nsCampo = medir([&]() { escenario.campo(); }, pares);
+
+        salida << qSetFieldWidth(10) << numEscombros
+               << qSetFieldWidth(14) << QString::number(nsEntidad, 'f', 2)
+               << qSetFieldWidth(14) << QString::number(nsEscalar, 'f', 2)
+               << qSetFieldWidth(14) << QString::number(nsSIMD, 'f', 2)
+               << qSetFieldWidth(14) << QString::number(nsCampo, 'f', 2)
+               << qSetFieldWidth(12) << QString::number(nsEntidad / nsSIMD, 'f', 1)
+               << qSetFieldWidth(12) << QString::number(nsEscalar / nsSIMD, 'f', 1)
+               << qSetFieldWidth(14) << QString::number(diferencia, 'g', 3)
+               << qSetFieldWidth(14) << QString::number(diferenciaCampo, 'g', 3)
+               << qSetFieldWidth(0) << "\n";
+    }
+
+    return 0;
+}
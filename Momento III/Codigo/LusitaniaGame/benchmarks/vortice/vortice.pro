@@ -0,0 +1,18 @@
+# Microbenchmark de las fuerzas de vortice: ruta por entidad
+# (Vortice::aplicarFuerzaA) contra el lote escalar, el lote SIMD
+# (FisicaVortice::aplicarCampoLote) y el campo en grilla (CampoVortices).
+# Uso: lusitania_bench_vortice --escombros 256,4096,65536 --vortices 5
+# Con CONFIG+=avx el lote usa AVX en vez de SSE2.
+
+QT       += core gui
+QT       -= widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = lusitania_bench_vortice
+
+include(../../nucleo.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,59 @@
+#ifndef BUFFERTRIPLE_H
+#define BUFFERTRIPLE_H
+
+#include <atomic>
+
+// Triple buffer de un productor y un consumidor, sin bloqueos
+// El productor escribe en su casilla y al publicar la cambia por la
+// intermedia; el consumidor, cuando quiere lo ultimo, cambia la suya
+// por la intermedia si hay algo nuevo. Ninguno espera al otro: si el
+// productor publica dos veces entre lecturas la anterior se pierde (no
+// se acumulan), y el consumidor puede releer su casilla cuantas veces
+// quiera mientras el productor escribe la siguiente.
+//
+// Las casillas se reutilizan: T conserva su memoria entre publicaciones.
+template <typename T>
+class BufferTriple {
+private:
+    T casillas[3];
+    int escritura;                  // Solo la usa el productor
+    int lectura;                    // Solo la usa el consumidor
+
+    // Indice de la intermedia (bits 0-1) + NUEVA si nadie la leyo
+    std::atomic<int> intermedia;
+    static const int NUEVA = 4;
+    static const int INDICE = 3;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    BufferTriple() : escritura(0), lectura(1), intermedia(2) {}
+
+    BufferTriple(const BufferTriple&) = delete;
+    BufferTriple& operator=(const BufferTriple&) = delete;
+
+    // ========== PRODUCTOR ==========
+    T& getEscritura() { return casillas[escritura]; }
+
+    void publicar() {
+        // acq_rel: lo escrito en la casilla es visible antes que el indice,
+        // y la casilla que se recibe ya la solto el consumidor
+        int anterior = intermedia.exchange(escritura | NUEVA, std::memory_order_acq_rel);
+        escritura = anterior & INDICE;
+    }
+
+    // ========== CONSUMIDOR ==========
+    // Pasa a la ultima publicacion; false si no habia nada nuevo
+    bool actualizar() {
+        if (!(intermedia.load(std::memory_order_relaxed) & NUEVA)) {
+            return false;
+        }
+
+        int anterior = intermedia.exchange(lectura, std::memory_order_acq_rel);
+        lectura = anterior & INDICE;
+        return true;
+    }
+
+    const T& getLectura() const { return casillas[lectura]; }
+};
+
+#endif // BUFFERTRIPLE_H
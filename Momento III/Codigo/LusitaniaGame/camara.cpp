@@ -4,13 +4,15 @@
 
 Camara::Camara()
     : posicion(0, 0), ancho(800), alto(600),
-    limiteMin(0, 0), limiteMax(2000, 2000), tieneScroll(true) {
+    limiteMin(0, 0), limiteMax(2000, 2000), tieneScroll(true),
+    posicionAnterior(0, 0), posicionSimulada(0, 0) {
     // Constructor por defecto: camara 800x600 con scroll
 }
 
 Camara::Camara(float _ancho, float _alto)
     : posicion(0, 0), ancho(_ancho), alto(_alto),
-    limiteMin(0, 0), limiteMax(2000, 2000), tieneScroll(true) {
+    limiteMin(0, 0), limiteMax(2000, 2000), tieneScroll(true),
+    posicionAnterior(0, 0), posicionSimulada(0, 0) {
     // Constructor con dimensiones especificas
 }
 
@@ -104,3 +106,29 @@ bool Camara::estaVisible(const Vector2D& punto) const {
     return punto.x >= posicion.x && punto.x <= posicion.x + ancho &&
            punto.y >= posicion.y && punto.y <= posicion.y + alto;
 }
+
+bool Camara::estaVisible(const QRectF& limites) const {
+    // Mismo criterio que CajaColision: separados en algun eje = no se ve
+    return !(limites.right() < posicion.x || limites.left() > posicion.x + ancho ||
+             limites.bottom() < posicion.y || limites.top() > posicion.y + alto);
+}
+
+QRectF Camara::getRectVisible() const {
+    return QRectF(posicion.x, posicion.y, ancho, alto);
+}
+
+// ========== INTERPOLACION ==========
+
+void Camara::guardarPosicionAnterior() {
+    posicionAnterior = posicion;
+}
+
+void Camara::interpolarPosicion(float alpha) {
+    // Ambos extremos ya respetan los limites, la mezcla tambien
+    posicionSimulada = posicion;
+    posicion = posicionAnterior + (posicionSimulada - posicionAnterior) * alpha;
+}
+
+void Camara::restaurarPosicion() {
+    posicion = posicionSimulada;
+}
@@ -2,6 +2,7 @@
 #define CAMARA_H
 
 #include "vector2d.h"
+#include <QRectF>
 
 // Sistema de camara para seguir al jugador y manejar scroll
 // Convierte coordenadas del mundo a coordenadas de pantalla
@@ -14,6 +15,10 @@ private:
     Vector2D limiteMax;     // Limite maximo del mundo (tamanio del nivel)
     bool tieneScroll;       // Si false, camara fija
 
+    // Interpolacion de render (paso fijo)
+    Vector2D posicionAnterior;
+    Vector2D posicionSimulada;
+
 public:
     // ========== CONSTRUCTORES ==========
     Camara();
@@ -40,6 +45,14 @@ public:
 
     // Verifica si un punto esta visible en pantalla
     bool estaVisible(const Vector2D& punto) const;
+    // Si una caja del mundo (limites visuales) toca el viewport
+    bool estaVisible(const QRectF& limites) const;
+    QRectF getRectVisible() const;           // Viewport en coordenadas del mundo
+
+    // ========== INTERPOLACION ==========
+    void guardarPosicionAnterior();
+    void interpolarPosicion(float alpha);
+    void restaurarPosicion();
 };
 
 #endif // CAMARA_H
@@ -0,0 +1,202 @@
+#include "campovortices.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// ========== CONSTRUCTOR ==========
+
+CampoVortices::CampoVortices(float tamanioCelda)
+    : tamanioCeldaBase(tamanioCelda),
+    tamanioCelda(tamanioCelda),
+    origenX(0.0f), origenY(0.0f),
+    columnas(0), filas(0) {
+}
+
+// ========== CONSTRUCCION ==========
+
+void CampoVortices::limpiar() {
+    fuentes.clear();
+    columnas = 0;
+    filas = 0;
+}
+
+void CampoVortices::agregarVortice(const Vector2D& centro, float rango, float fuerzaMaxima,
+                                   float fraccionTangencial) {
+    if (rango <= 0.0f) return;
+    fuentes.push_back({centro, rango, fuerzaMaxima, fraccionTangencial});
+}
+
+void CampoVortices::construir() {
+    columnas = 0;
+    filas = 0;
+    if (fuentes.empty()) return;
+
+    // Caja que encierra todos los rangos
+    float minX = fuentes[0].centro.x - fuentes[0].rango;
+    float maxX = fuentes[0].centro.x + fuentes[0].rango;
+    float minY = fuentes[0].centro.y - fuentes[0].rango;
+    float maxY = fuentes[0].centro.y + fuentes[0].rango;
+
+    for (const auto& f : fuentes) {
+        minX = std::min(minX, f.centro.x - f.rango);
+        maxX = std::max(maxX, f.centro.x + f.rango);
+        minY = std::min(minY, f.centro.y - f.rango);
+        maxY = std::max(maxY, f.centro.y + f.rango);
+    }
+
+    // Si la caja pide demasiados nodos se agranda la celda
+    tamanioCelda = tamanioCeldaBase;
+    float area = (maxX - minX) * (maxY - minY);
+    if (area / (tamanioCelda * tamanioCelda) > MAX_NODOS) {
+        tamanioCelda = std::sqrt(area / MAX_NODOS);
+    }
+
+    // Origen alineado a la celda: la grilla no se corre entre pasos
+    // aunque los vortices cambien, y un cuerpo quieto lee lo mismo
+    origenX = std::floor(minX / tamanioCelda) * tamanioCelda;
+    origenY = std::floor(minY / tamanioCelda) * tamanioCelda;
+    columnas = std::max(1, (int)std::ceil((maxX - origenX) / tamanioCelda));
+    filas = std::max(1, (int)std::ceil((maxY - origenY) / tamanioCelda));
+
+    size_t nodos = (size_t)(columnas + 1) * (filas + 1);
+    fuerzaX.assign(nodos, 0.0f);
+    fuerzaY.assign(nodos, 0.0f);
+    celdaNucleo.assign((size_t)columnas * filas, 0);
+
+    for (const auto& f : fuentes) {
+        sumarFuente(f);
+        marcarNucleo(f);
+    }
+}
+
+Vector2D CampoVortices::fuerzaDe(const Fuente& f, float x, float y) {
+    float dx = f.centro.x - x;
+    float dy = f.centro.y - y;
+    float distancia = std::sqrt(dx * dx + dy * dy);
+
+    if (distancia >= f.rango || distancia < 1.0f) return Vector2D(0, 0);
+
+    float factor = 1.0f - distancia / f.rango;
+    float escala = f.fuerzaMaxima * factor * factor / distancia;
+
+    return Vector2D((dx - f.fraccionTangencial * dy) * escala,
+                    (dy + f.fraccionTangencial * dx) * escala);
+}
+
+int CampoVortices::celdaDe(float coordenada, float origen) const {
+    return (int)std::floor((coordenada - origen) / tamanioCelda);
+}
+
+void CampoVortices::marcarNucleo(const Fuente& f) {
+    int colCentro = celdaDe(f.centro.x, origenX);
+    int filaCentro = celdaDe(f.centro.y, origenY);
+
+    int colMin = std::max(0, colCentro - RADIO_NUCLEO);
+    int colMax = std::min(columnas - 1, colCentro + RADIO_NUCLEO);
+    int filaMin = std::max(0, filaCentro - RADIO_NUCLEO);
+    int filaMax = std::min(filas - 1, filaCentro + RADIO_NUCLEO);
+
+    for (int fila = filaMin; fila <= filaMax; fila++) {
+        for (int col = colMin; col <= colMax; col++) {
+            celdaNucleo[(size_t)fila * columnas + col] = 1;
+        }
+    }
+}
+
+void CampoVortices::sumarFuente(const Fuente& f) {
+    // Solo los nodos dentro del cuadrado del rango
+    int colMin = std::max(0, (int)std::ceil((f.centro.x - f.rango - origenX) / tamanioCelda));
+    int colMax = std::min(columnas, (int)std::floor((f.centro.x + f.rango - origenX) / tamanioCelda));
+    int filaMin = std::max(0, (int)std::ceil((f.centro.y - f.rango - origenY) / tamanioCelda));
+    int filaMax = std::min(filas, (int)std::floor((f.centro.y + f.rango - origenY) / tamanioCelda));
+
+    const int ancho = columnas + 1;
+
+    for (int fila = filaMin; fila <= filaMax; fila++) {
+        float y = origenY + fila * tamanioCelda;
+
+        for (int col = colMin; col <= colMax; col++) {
+            Vector2D fuerza = fuerzaDe(f, origenX + col * tamanioCelda, y);
+
+            size_t nodo = (size_t)fila * ancho + col;
+            fuerzaX[nodo] += fuerza.x;
+            fuerzaY[nodo] += fuerza.y;
+        }
+    }
+}
+
+// ========== CONSULTA ==========
+
+Vector2D CampoVortices::muestrear(float x, float y) const {
+    if (columnas == 0) return Vector2D(0, 0);
+
+    float gx = (x - origenX) / tamanioCelda;
+    float gy = (y - origenY) / tamanioCelda;
+
+    // Fuera de la caja ningun vortice alcanza
+    if (gx < 0.0f || gy < 0.0f || gx >= columnas || gy >= filas) {
+        return Vector2D(0, 0);
+    }
+
+    int col = (int)gx;
+    int fila = (int)gy;
+    float tx = gx - col;
+    float ty = gy - fila;
+
+    const int ancho = columnas + 1;
+    size_t n00 = (size_t)fila * ancho + col;
+    size_t n10 = n00 + 1;
+    size_t n01 = n00 + ancho;
+    size_t n11 = n01 + 1;
+
+    float w00 = (1.0f - tx) * (1.0f - ty);
+    float w10 = tx * (1.0f - ty);
+    float w01 = (1.0f - tx) * ty;
+    float w11 = tx * ty;
+
+    Vector2D fuerza(fuerzaX[n00] * w00 + fuerzaX[n10] * w10 + fuerzaX[n01] * w01 + fuerzaX[n11] * w11,
+                    fuerzaY[n00] * w00 + fuerzaY[n10] * w10 + fuerzaY[n01] * w01 + fuerzaY[n11] * w11);
+
+    if (celdaNucleo[(size_t)fila * columnas + col]) {
+        fuerza += corregirNucleo(x, y, col, fila, tx, ty);
+    }
+    return fuerza;
+}
+
+Vector2D CampoVortices::corregirNucleo(float x, float y, int col, int fila, float tx, float ty) const {
+    // Para cada vortice con el centro cerca: fuerza exacta menos lo que
+    // aporto a la interpolacion de esta celda
+    Vector2D correccion(0, 0);
+
+    float x0 = origenX + col * tamanioCelda;
+    float y0 = origenY + fila * tamanioCelda;
+    float x1 = x0 + tamanioCelda;
+    float y1 = y0 + tamanioCelda;
+
+    for (const auto& f : fuentes) {
+        if (std::abs(celdaDe(f.centro.x, origenX) - col) > RADIO_NUCLEO ||
+            std::abs(celdaDe(f.centro.y, origenY) - fila) > RADIO_NUCLEO) {
+            continue;
+        }
+
+        Vector2D interpolada = fuerzaDe(f, x0, y0) * ((1.0f - tx) * (1.0f - ty))
+                             + fuerzaDe(f, x1, y0) * (tx * (1.0f - ty))
+                             + fuerzaDe(f, x0, y1) * ((1.0f - tx) * ty)
+                             + fuerzaDe(f, x1, y1) * (tx * ty);
+
+        correccion += fuerzaDe(f, x, y) - interpolada;
+    }
+
+    return correccion;
+}
+
+void CampoVortices::aplicarLote(const float* posX, const float* posY,
+                                float* velX, float* velY, size_t n, float dt) const {
+    if (columnas == 0) return;
+
+    for (size_t i = 0; i < n; i++) {
+        Vector2D fuerza = muestrear(posX[i], posY[i]);
+        velX[i] += fuerza.x * dt;
+        velY[i] += fuerza.y * dt;
+    }
+}
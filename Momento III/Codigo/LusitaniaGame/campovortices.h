@@ -0,0 +1,84 @@
+#ifndef CAMPOVORTICES_H
+#define CAMPOVORTICES_H
+
+#include "vector2d.h"
+#include <cstddef>
+#include <vector>
+
+// Campo de fuerza de todos los vortices en una grilla gruesa
+// Cada paso se suman los vortices activos en los nodos de la grilla (una
+// vez por nodo dentro del rango de cada uno) y despues cada cuerpo lee
+// su fuerza con una interpolacion bilineal de los 4 nodos que lo rodean.
+// El costo es O(nodos + cuerpos) en vez de O(vortices × cuerpos).
+//
+// Cerca del centro la direccion de la fuerza gira de golpe y los nodos
+// opuestos se cancelan: la interpolacion daria casi cero justo donde la
+// fuerza es maxima. Por eso las celdas a RADIO_NUCLEO celdas o menos del
+// centro de un vortice quedan marcadas, y ahi ese vortice se calcula
+// exacto (se cambia su parte interpolada por la fuerza real).
+//
+// La grilla cubre solo la caja que encierra los rangos de atraccion (los
+// vortices nacen cerca del jugador, asi que es la zona de la camara):
+// fuera de ella ningun vortice llega y la fuerza es cero, igual que con
+// el calculo exacto. La fuerza de cada vortice es la de
+// FisicaVortice::aplicarCampoLote:
+//   F = F_max × (1 - d/rango)²  para 1 <= d < rango
+//   dirección radial + fraccionTangencial × perpendicular
+class CampoVortices {
+private:
+    struct Fuente {
+        Vector2D centro;
+        float rango;
+        float fuerzaMaxima;
+        float fraccionTangencial;
+    };
+
+    std::vector<Fuente> fuentes;
+
+    // ===== GRILLA (NODOS EN LAS ESQUINAS DE LAS CELDAS) =====
+    float tamanioCeldaBase;
+    float tamanioCelda;             // Puede crecer si la caja es muy grande
+    float origenX, origenY;         // Nodo (0, 0), alineado a la celda
+    int columnas, filas;            // Celdas; hay (columnas+1)×(filas+1) nodos
+    std::vector<float> fuerzaX;
+    std::vector<float> fuerzaY;
+    std::vector<unsigned char> celdaNucleo;     // 1 = hay un centro cerca
+
+    static const int MAX_NODOS = 16384;
+    static const int RADIO_NUCLEO = 2;          // Celdas alrededor del centro
+
+    void sumarFuente(const Fuente& f);
+    void marcarNucleo(const Fuente& f);
+    Vector2D corregirNucleo(float x, float y, int col, int fila, float tx, float ty) const;
+    int celdaDe(float coordenada, float origen) const;
+
+    // Fuerza exacta de una fuente en (x, y)
+    static Vector2D fuerzaDe(const Fuente& f, float x, float y);
+
+public:
+    // ========== CONSTRUCTOR ==========
+    explicit CampoVortices(float tamanioCelda = 32.0f);
+
+    // ========== CONSTRUCCION (UNA VEZ POR PASO) ==========
+    void limpiar();
+    void agregarVortice(const Vector2D& centro, float rango, float fuerzaMaxima,
+                        float fraccionTangencial = 0.0f);
+    void construir();
+
+    // ========== CONSULTA ==========
+    bool estaVacio() const { return fuentes.empty(); }
+    Vector2D muestrear(float x, float y) const;
+
+    // v += F(p) × dt para n cuerpos en arreglos (como aplicarCampoLote,
+    // pero con todos los vortices de una vez)
+    void aplicarLote(const float* posX, const float* posY,
+                     float* velX, float* velY, size_t n, float dt) const;
+
+    // ========== GETTERS ==========
+    float getTamanioCelda() const { return tamanioCelda; }
+    int getColumnas() const { return columnas; }
+    int getFilas() const { return filas; }
+    int getNumeroVortices() const { return (int)fuentes.size(); }
+};
+
+#endif // CAMPOVORTICES_H
@@ -0,0 +1,51 @@
+#include "capaestatica.h"
+
+// ========== CONSTRUCTOR ==========
+
+CapaEstatica::CapaEstatica()
+    : valida(false) {
+}
+
+CapaEstatica::CapaEstatica(const QRect& areaCapa)
+    : area(areaCapa),
+    valida(false) {
+}
+
+// ========== CONFIGURACION ==========
+
+void CapaEstatica::setArea(const QRect& areaCapa) {
+    if (areaCapa == area) return;
+
+    area = areaCapa;
+    invalidar();
+}
+
+void CapaEstatica::invalidar() {
+    valida = false;
+}
+
+// ========== DIBUJO ==========
+
+void CapaEstatica::dibujar(QPainter& painter, const std::function<void(QPainter&)>& pintar,
+                           const QPointF& desplazamiento) {
+    if (area.isEmpty()) return;
+
+    // En pantallas HiDPI la capa se pinta a la resolucion real
+    qreal escala = painter.device() ? painter.device()->devicePixelRatioF() : 1.0;
+
+    if (!valida || imagen.devicePixelRatio() != escala) {
+        imagen = QPixmap(area.size() * escala);
+        imagen.setDevicePixelRatio(escala);
+        imagen.fill(Qt::transparent);
+
+        QPainter pintor(&imagen);
+        pintor.setRenderHints(painter.renderHints());
+        pintor.translate(-area.topLeft());
+        pintar(pintor);
+        pintor.end();
+
+        valida = true;
+    }
+
+    painter.drawPixmap(QPointF(area.topLeft()) + desplazamiento, imagen);
+}
@@ -0,0 +1,45 @@
+#ifndef CAPAESTATICA_H
+#define CAPAESTATICA_H
+
+#include <QPainter>
+#include <QPixmap>
+#include <QPointF>
+#include <QRect>
+#include <functional>
+
+// Capa de dibujo que no cambia (o casi) entre frames: fondo degradado,
+// casco del barco, superficie del nivel 3...
+// Se pinta una sola vez en un QPixmap fuera de pantalla y cada frame
+// solo se copia, en vez de rehacer degradados, poligonos y texto.
+//
+// 'area' esta en las coordenadas en que dibuja quien la usa; dibujar()
+// puede desplazarla (una capa que se mueve entera, como el barco que
+// oscila, se cachea en coordenadas locales y se copia en su posicion).
+class CapaEstatica {
+private:
+    QPixmap imagen;
+    QRect area;
+    bool valida;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    CapaEstatica();
+    explicit CapaEstatica(const QRect& areaCapa);
+
+    // ========== CONFIGURACION ==========
+    void setArea(const QRect& areaCapa);        // Invalida la capa
+    QRect getArea() const { return area; }
+
+    // El contenido cambio: se vuelve a pintar en el proximo dibujar()
+    void invalidar();
+    bool esValida() const { return valida; }
+
+    // ========== DIBUJO ==========
+    // Copia la capa en area.topLeft() + desplazamiento. Si no es valida
+    // (o cambio la escala de pantalla) llama antes a 'pintar' con las
+    // mismas coordenadas que usaria sobre 'painter'
+    void dibujar(QPainter& painter, const std::function<void(QPainter&)>& pintar,
+                 const QPointF& desplazamiento = QPointF(0, 0));
+};
+
+#endif // CAPAESTATICA_H
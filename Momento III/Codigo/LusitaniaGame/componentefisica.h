@@ -6,21 +6,39 @@
 // Forward declaration (evita includes circulares)
 class Entidad;
 
+// Tipo concreto del componente
+// MotorFisica agrupa las entidades por este tipo y llama calcular() de
+// cada grupo sin pasar por la tabla virtual (las clases son final).
+// OTRA = cualquier componente nuevo: va por la llamada virtual.
+enum class TipoFisica {
+    FLOTACION,      // FisicaFlotacion
+    VORTICE,        // FisicaVortice
+    PARABOLICA,     // TrayectoriaParabolica
+    CIRCULAR,       // MovimientoCircular
+    OSCILADOR,      // OsciladorArmonico
+    OTRA
+};
+
 // Clase abstracta base para todos los componentes fisicos
 // Diferentes físicas intercambiables
 class ComponenteFisica {
+private:
+    TipoFisica tipoFisica;
+
 public:
-    ComponenteFisica() {}
+    explicit ComponenteFisica(TipoFisica tipo = TipoFisica::OTRA) : tipoFisica(tipo) {}
     virtual ~ComponenteFisica() {}
 
+    TipoFisica getTipoFisica() const { return tipoFisica; }
+
     // ========== METODOS VIRTUALES PUROS ==========
     // Cada fisica especifica debe implementar estos metodos
 
     // Calcula el nuevo valor (posicion, velocidad, etc.) basado en el tiempo
     virtual Vector2D calcular(Entidad* e, float dt) = 0;
 
-    // Aplica la fisica a la entidad
-    virtual void aplicar(Entidad* e) = 0;
+    // Aplica la fisica a la entidad (dt = paso de simulacion)
+    virtual void aplicar(Entidad* e, float dt) = 0;
 };
 
 #endif // COMPONENTEFISICA_H
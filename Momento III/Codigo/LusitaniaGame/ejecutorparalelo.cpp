@@ -0,0 +1,151 @@
+#include "ejecutorparalelo.h"
+#include <QFile>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+
+// ========== CONSTRUCTOR ==========
+
+EjecutorParalelo::EjecutorParalelo(int hilos)
+    : numeroHilos(hilos),
+    tiempoReal(0.0) {
+
+    if (numeroHilos <= 0) {
+        numeroHilos = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    if (numeroHilos <= 0) {
+        numeroHilos = 1;
+    }
+}
+
+// ========== CONFIGURACION ==========
+
+void EjecutorParalelo::agregarLote(const SimuladorHeadless& simulador, int episodios) {
+    if (episodios > 0) {
+        lotes.emplace_back(simulador, episodios);
+    }
+}
+
+void EjecutorParalelo::limpiarLotes() {
+    lotes.clear();
+}
+
+// ========== EJECUCION ==========
+
+std::vector<ResultadoEpisodio> EjecutorParalelo::ejecutar() {
+    // 1. Lista plana de tareas (lote, episodio)
+    std::vector<std::pair<int, int>> tareas;
+    for (size_t l = 0; l < lotes.size(); l++) {
+        for (int e = 0; e < lotes[l].episodios; e++) {
+            tareas.emplace_back(static_cast<int>(l), e);
+        }
+    }
+
+    std::vector<ResultadoEpisodio> resultados(tareas.size());
+    if (tareas.empty()) {
+        tiempoReal = 0.0;
+        return resultados;
+    }
+
+    // 2. Los hilos toman la siguiente tarea libre de un contador atomico:
+    // los episodios largos no dejan a los demas hilos esperando
+    std::atomic<size_t> siguienteTarea(0);
+
+    auto trabajador = [&]() {
+        // Copia propia de cada simulador: su generador de entrada es estado mutable
+        std::vector<SimuladorHeadless> simuladores;
+        simuladores.reserve(lotes.size());
+        for (const auto& lote : lotes) {
+            simuladores.push_back(lote.simulador);
+        }
+
+        while (true) {
+            size_t t = siguienteTarea.fetch_add(1, std::memory_order_relaxed);
+            if (t >= tareas.size()) break;
+
+            // Cada hilo escribe solo su casilla: no hace falta mutex
+            resultados[t] = simuladores[tareas[t].first].ejecutarEpisodio(tareas[t].second);
+        }
+    };
+
+    int hilosUsados = std::min(numeroHilos, static_cast<int>(tareas.size()));
+
+    QElapsedTimer reloj;
+    reloj.start();
+
+    if (hilosUsados <= 1) {
+        trabajador();
+    } else {
+        std::vector<std::thread> hilos;
+        hilos.reserve(hilosUsados);
+        for (int i = 0; i < hilosUsados; i++) {
+            hilos.emplace_back(trabajador);
+        }
+        for (auto& hilo : hilos) {
+            hilo.join();
+        }
+    }
+
+    tiempoReal = reloj.nsecsElapsed() / 1.0e9;
+    return resultados;
+}
+
+// ========== SALIDA ==========
+
+bool EjecutorParalelo::escribirCSV(const std::vector<ResultadoEpisodio>& resultados, const QString& ruta) {
+    QFile archivo;
+    bool abierto = false;
+
+    if (ruta == "-") {
+        abierto = archivo.open(stdout, QIODevice::WriteOnly | QIODevice::Text);
+    } else {
+        archivo.setFileName(ruta);
+        abierto = archivo.open(QIODevice::WriteOnly | QIODevice::Text);
+    }
+
+    if (!abierto) {
+        qWarning() << "No se pudo escribir el CSV:" << ruta;
+        return false;
+    }
+
+    QTextStream salida(&archivo);
+    salida << "nivel,episodio,semilla,puntuacion,resultado,pasos,tiempo_simulado_s,tiempo_real_ms\n";
+
+    for (const auto& r : resultados) {
+        const char* resultado = r.completado ? "victoria" : (r.fallado ? "derrota" : "tiempo");
+
+        salida << r.nivel << ','
+               << r.episodio << ','
+               << static_cast<qulonglong>(r.semilla) << ','
+               << r.puntuacion << ','
+               << resultado << ','
+               << r.pasos << ','
+               << r.tiempoSimulado << ','
+               << r.tiempoReal * 1000.0 << '\n';
+    }
+
+    salida.flush();
+    return true;
+}
+
+// ========== GETTERS ==========
+
+int EjecutorParalelo::getNumeroHilos() const {
+    return numeroHilos;
+}
+
+int EjecutorParalelo::getTotalEpisodios() const {
+    int total = 0;
+    for (const auto& lote : lotes) {
+        total += lote.episodios;
+    }
+    return total;
+}
+
+double EjecutorParalelo::getTiempoReal() const {
+    return tiempoReal;
+}
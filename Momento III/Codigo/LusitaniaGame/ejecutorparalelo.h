@@ -0,0 +1,50 @@
+#ifndef EJECUTORPARALELO_H
+#define EJECUTORPARALELO_H
+
+#include "simuladorheadless.h"
+#include <QString>
+#include <vector>
+
+// Ejecuta muchos episodios independientes repartidos entre varios hilos
+// Cada hilo tiene su propia copia del simulador y cada episodio crea su
+// propio Nivel (con su MotorFisica y su generador), asi que los hilos
+// no comparten estado. No usa MotorJuego, GestorSprites ni GestorSonidos.
+// El resultado de cada episodio depende solo de (semilla, indice):
+// la salida es la misma con 1 o con N hilos.
+class EjecutorParalelo {
+private:
+    // Un lote: N episodios de un mismo simulador (nivel + configuracion)
+    struct Lote {
+        SimuladorHeadless simulador;
+        int episodios;
+
+        Lote(const SimuladorHeadless& s, int n) : simulador(s), episodios(n) {}
+    };
+
+    std::vector<Lote> lotes;
+    int numeroHilos;
+    double tiempoReal;          // Segundos de reloj de la ultima ejecucion
+
+public:
+    // ========== CONSTRUCTOR ==========
+    explicit EjecutorParalelo(int hilos = 0);     // 0 = un hilo por nucleo
+
+    // ========== CONFIGURACION ==========
+    void agregarLote(const SimuladorHeadless& simulador, int episodios);
+    void limpiarLotes();
+
+    // ========== EJECUCION ==========
+    // Resultados en orden de lote y de episodio (no de terminacion)
+    std::vector<ResultadoEpisodio> ejecutar();
+
+    // ========== SALIDA ==========
+    // Una fila por episodio; ruta "-" = salida estandar
+    static bool escribirCSV(const std::vector<ResultadoEpisodio>& resultados, const QString& ruta);
+
+    // ========== GETTERS ==========
+    int getNumeroHilos() const;
+    int getTotalEpisodios() const;
+    double getTiempoReal() const;
+};
+
+#endif // EJECUTORPARALELO_H
@@ -0,0 +1,17 @@
+# Empaquetador de assets: genera assets.lpk (atlas ya empaquetados y
+# sonidos) a partir de la carpeta assets/. El juego lo busca junto al
+# ejecutable; sin el, carga la carpeta suelta como antes.
+# Uso: lusitania_empaquetador --assets ../assets --salida assets.lpk
+
+QT       += core gui
+QT       -= widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = lusitania_empaquetador
+
+include(../nucleo.pri)
+
+SOURCES += \
+    main.cpp
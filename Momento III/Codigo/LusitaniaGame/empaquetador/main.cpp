@@ -0,0 +1,89 @@
+#include "archivoassets.h"
+#include "gestorsprites.h"
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QTextStream>
+
+// ========== LUSITANIA EMPAQUETADOR ==========
+// Genera assets.lpk a partir de la carpeta assets/: decodifica cada
+// paquete de sprites (menu + un nivel por paquete), lo empaqueta en
+// atlas y guarda las paginas ya premultiplicadas, junto con los sonidos.
+// El juego lo mapea a memoria al arrancar en vez de leer la carpeta.
+
+int main(int argc, char *argv[]) {
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("lusitania_empaquetador");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Empaquetador de assets de El Naufragio del Lusitania");
+    parser.addHelpOption();
+
+    QCommandLineOption opcionAssets("assets", "Carpeta assets/ (con sprites/ y sounds/).", "carpeta", "assets");
+    QCommandLineOption opcionSalida("salida", "Archivo a generar.", "archivo", "assets.lpk");
+    QCommandLineOption opcionSinComprimir("sin-comprimir", "Guardar los pixeles sin qCompress (mas grande, sin descompresion al cargar).");
+
+    parser.addOption(opcionAssets);
+    parser.addOption(opcionSalida);
+    parser.addOption(opcionSinComprimir);
+    parser.process(app);
+
+    QLoggingCategory::setFilterRules("default.debug=false");
+
+    QTextStream salida(stdout);
+
+    QDir carpeta(parser.value(opcionAssets));
+    if (!carpeta.exists()) {
+        salida << "No existe la carpeta de assets: " << carpeta.absolutePath() << Qt::endl;
+        return 1;
+    }
+
+    // ===== SPRITES =====
+    QString rutaSprites = carpeta.absolutePath() + "/sprites/";
+    QMap<int, AtlasTexturas> paquetes;
+
+    for (int paquete = 0; paquete < GestorSprites::NUM_PAQUETES; paquete++) {
+        QVector<ArchivoSprite> archivos = GestorSprites::archivosPaquete(paquete, rutaSprites);
+
+        for (const ArchivoSprite& archivo : archivos) {
+            if (!QFileInfo::exists(archivo.ruta)) {
+                salida << "  (falta) " << archivo.ruta << Qt::endl;
+            }
+        }
+
+        AtlasTexturas atlas = GestorSprites::decodificarPaquete(archivos);
+        salida << "Paquete " << paquete << ": " << atlas.getRegiones().size() << " sprites en "
+               << atlas.getNumPaginas() << " paginas ("
+               << qRound(atlas.getOcupacion() * 100) << "% ocupado)" << Qt::endl;
+
+        paquetes[paquete] = atlas;
+    }
+
+    // ===== SONIDOS =====
+    QMap<QString, QByteArray> datos;
+    QDir carpetaSonidos(carpeta.absolutePath() + "/sounds");
+
+    for (const QFileInfo& info : carpetaSonidos.entryInfoList({"*.mp3"}, QDir::Files, QDir::Name)) {
+        QFile archivo(info.absoluteFilePath());
+        if (archivo.open(QIODevice::ReadOnly)) {
+            datos["sonidos/" + info.completeBaseName()] = archivo.readAll();
+        }
+    }
+    salida << "Sonidos: " << datos.size() << Qt::endl;
+
+    // ===== ESCRITURA =====
+    QString rutaSalida = parser.value(opcionSalida);
+    if (!ArchivoAssets::escribir(rutaSalida, paquetes, datos, !parser.isSet(opcionSinComprimir))) {
+        return 1;
+    }
+
+    salida << "Escrito " << rutaSalida << " (" << QFileInfo(rutaSalida).size() / 1024 << " KB)" << Qt::endl;
+    return 0;
+}
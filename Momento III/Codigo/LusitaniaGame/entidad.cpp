@@ -9,6 +9,14 @@ Entidad::Entidad()
     tipo(TipoEntidad::JUGADOR),
     activo(true),
     fisica(nullptr),
+    movimientoRapido(false),
+    posicionInicioPaso(0, 0),
+    puedeDormir(false),
+    dormido(false),
+    pasosQuieto(0),
+    apoyado(false),
+    posicionAnterior(0, 0),
+    posicionSimulada(0, 0),
     ancho(32), alto(32) {
     // Constructor por defecto
 }
@@ -19,6 +27,14 @@ Entidad::Entidad(const Vector2D& pos, TipoEntidad t)
     tipo(t),
     activo(true),
     fisica(nullptr),
+    movimientoRapido(false),
+    posicionInicioPaso(pos),
+    puedeDormir(false),
+    dormido(false),
+    pasosQuieto(0),
+    apoyado(false),
+    posicionAnterior(pos),
+    posicionSimulada(pos),
     ancho(32), alto(32) {
     // Constructor con posicion y tipo
 }
@@ -89,6 +105,104 @@ void Entidad::actualizarColision() {
     colision.alto = alto;
 }
 
+// ========== COLISION CONTINUA ==========
+
+bool Entidad::esMovimientoRapido() const {
+    return movimientoRapido;
+}
+
+void Entidad::setMovimientoRapido(bool rapido) {
+    movimientoRapido = rapido;
+}
+
+void Entidad::guardarInicioPaso() {
+    posicionInicioPaso = posicion;
+}
+
+Vector2D Entidad::getPosicionInicioPaso() const {
+    return posicionInicioPaso;
+}
+
+// ========== SUEÑO ==========
+
+bool Entidad::getPuedeDormir() const {
+    return puedeDormir;
+}
+
+void Entidad::setPuedeDormir(bool puede) {
+    puedeDormir = puede;
+    if (!puede) {
+        despertar();
+    }
+}
+
+bool Entidad::estaDormido() const {
+    return dormido;
+}
+
+void Entidad::evaluarSueno(float umbralVelocidad, int pasosParaDormir) {
+    // El apoyo vale por una evaluacion: hay que volver a marcarlo
+    bool sostenido = apoyado;
+    apoyado = false;
+
+    if (!puedeDormir || dormido) return;
+
+    if (sostenido && velocidad.magnitud() < umbralVelocidad) {
+        pasosQuieto++;
+        if (pasosQuieto >= pasosParaDormir) {
+            dormir();
+        }
+    } else {
+        pasosQuieto = 0;
+    }
+}
+
+void Entidad::marcarApoyo() {
+    apoyado = true;
+}
+
+bool Entidad::estaApoyado() const {
+    return apoyado;
+}
+
+void Entidad::dormir() {
+    dormido = true;
+    velocidad = Vector2D(0, 0);
+}
+
+void Entidad::despertar() {
+    if (!dormido) return;
+
+    dormido = false;
+    pasosQuieto = 0;
+}
+
+void Entidad::aplicarImpulso(const Vector2D& cambioVelocidad) {
+    velocidad += cambioVelocidad;
+    despertar();
+    pasosQuieto = 0;
+}
+
+// ========== INTERPOLACION ==========
+
+void Entidad::guardarPosicionAnterior() {
+    posicionAnterior = posicion;
+}
+
+void Entidad::interpolarPosicion(float alpha) {
+    // No toca la caja de colision: solo cambia donde se dibuja
+    posicionSimulada = posicion;
+    posicion = posicionAnterior + (posicionSimulada - posicionAnterior) * alpha;
+}
+
+void Entidad::restaurarPosicion() {
+    posicion = posicionSimulada;
+}
+
+Vector2D Entidad::getPosicionAnterior() const {
+    return posicionAnterior;
+}
+
 // ========== GETTERS ==========
 
 Vector2D Entidad::getPosicion() const {
@@ -107,6 +221,10 @@ bool Entidad::estaActivo() const {
     return activo;
 }
 
+HandleEntidad Entidad::getHandle() const {
+    return handle;
+}
+
 int Entidad::getAncho() const {
     return ancho;
 }
@@ -115,6 +233,10 @@ int Entidad::getAlto() const {
     return alto;
 }
 
+QRectF Entidad::getLimitesVisuales() const {
+    return QRectF(posicion.x, posicion.y, ancho, alto);
+}
+
 // ========== SETTERS ==========
 
 void Entidad::setPosicion(const Vector2D& pos) {
@@ -135,3 +257,7 @@ void Entidad::setDimensiones(int w, int h) {
     alto = h;
     actualizarColision();
 }
+
+void Entidad::setHandle(const HandleEntidad& h) {
+    handle = h;
+}
@@ -4,6 +4,7 @@
 #include "vector2d.h"
 #include "tipos.h"
 #include <QPainter>
+#include <QRectF>
 
 class ComponenteFisica;
 
@@ -17,6 +18,21 @@ protected:
     TipoEntidad tipo;            // Tipo de entidad (para identificar)
     bool activo;                 // Si esta viva/activa
     ComponenteFisica* fisica;    // Componente de fisica (puede ser nullptr)
+    HandleEntidad handle;        // Ranura en el registro del motor (nulo = fuera del motor)
+
+    // Colision continua (proyectiles)
+    bool movimientoRapido;       // El motor la prueba con todo su recorrido del paso
+    Vector2D posicionInicioPaso; // La guarda el motor antes de mover
+
+    // Sueño (cuerpos en reposo)
+    bool puedeDormir;            // false = siempre despierta (por defecto)
+    bool dormido;                // El motor no la integra ni la prueba con otras dormidas
+    int pasosQuieto;             // Pasos seguidos por debajo del umbral
+    bool apoyado;                // Tocó algo (piso, otra caja) desde la ultima evaluacion
+
+    // Interpolacion de render (paso fijo)
+    Vector2D posicionAnterior;   // Posicion al inicio del ultimo paso
+    Vector2D posicionSimulada;   // Respaldo mientras se dibuja interpolado
 
     // Sprite (simplificado por ahora)
     int ancho, alto;             // Dimensiones visuales
@@ -36,6 +52,11 @@ public:
     virtual void destruir();
     virtual void onColision(Entidad* otra);
 
+    // Zona del mundo que puede tocar renderizar(): la caja visual mas lo
+    // que sobresale (barras de vida, brillos, texto). Sirve para saber
+    // que repintar; por defecto es la caja ancho×alto
+    virtual QRectF getLimitesVisuales() const;
+
     // ========== FISICA ==========
     void setFisica(ComponenteFisica* f);
     ComponenteFisica* getFisica() const;
@@ -46,11 +67,44 @@ public:
     CajaColision getColision() const;
     void actualizarColision();  // Sincroniza caja con posicion
 
+    // ========== COLISION CONTINUA ==========
+    // Lo bastante rapida para atravesar una caja en un solo paso: el
+    // motor prueba la caja barrida desde el inicio del paso y avisa
+    // solo el primer impacto
+    bool esMovimientoRapido() const;
+    void setMovimientoRapido(bool rapido);
+    void guardarInicioPaso();               // Lo llama MotorFisica
+    Vector2D getPosicionInicioPaso() const;
+
+    // ========== SUEÑO ==========
+    // Quieta y apoyada varios pasos seguidos: el motor deja de
+    // actualizarla hasta que algo la despierte (contacto con una
+    // despierta, impulso, o lo que decida la subclase). Sin apoyo no
+    // cuenta: una que recien empieza a caer tambien va lento
+    bool getPuedeDormir() const;
+    void setPuedeDormir(bool puede);
+    bool estaDormido() const;
+    void evaluarSueno(float umbralVelocidad, int pasosParaDormir);  // Lo llama MotorFisica
+    void marcarApoyo();          // El motor (contacto) o el nivel (piso) la sostienen
+    bool estaApoyado() const;
+    void dormir();
+    void despertar();
+    void aplicarImpulso(const Vector2D& cambioVelocidad);          // Despierta
+
+    // ========== INTERPOLACION ==========
+    // El bucle de paso fijo guarda la posicion antes de cada paso y
+    // dibuja una mezcla entre el paso anterior y el actual
+    void guardarPosicionAnterior();
+    void interpolarPosicion(float alpha);   // Solo para renderizar
+    void restaurarPosicion();               // Deshace interpolarPosicion
+    Vector2D getPosicionAnterior() const;
+
     // ========== GETTERS ==========
     Vector2D getPosicion() const;
     Vector2D getVelocidad() const;
     TipoEntidad getTipo() const;
     bool estaActivo() const;
+    HandleEntidad getHandle() const;
     int getAncho() const;
     int getAlto() const;
 
@@ -59,6 +113,7 @@ public:
     void setVelocidad(const Vector2D& vel);
     void setActivo(bool estado);
     void setDimensiones(int w, int h);
+    void setHandle(const HandleEntidad& h);     // Solo RegistroEntidades
 };
 
 #endif // ENTIDAD_H
@@ -6,6 +6,10 @@
 #include "tipos.h"
 #include <QPainter>
 
+// Escombro como entidad del motor (un objeto por escombro)
+// Nivel 3 ya no la usa: sus escombros viven en SistemaEscombros (arreglos
+// contiguos). Queda como la ruta por entidad contra la que se comparan
+// los lotes en benchmarks/
 class Escombro : public Entidad {
 private:
     TipoEscombro tipoEscombro;
@@ -1,10 +1,12 @@
 #include "fisicaflotacion.h"
+#include "poolobjetos.h"
 #include <algorithm>
 
 // ========== CONSTRUCTORES ==========
 
 FisicaFlotacion::FisicaFlotacion()
-    : densidadObjeto(1.0f),    // Neutro por defecto
+    : ComponenteFisica(TipoFisica::FLOTACION),
+    densidadObjeto(1.0f),    // Neutro por defecto
     densidadAgua(1.0f),       // Agua siempre 1.0
     gravedad(9.8f),           // g simulada
     velocidadTerminal(100.0f), // Maximo 100 px/s
@@ -13,7 +15,8 @@ FisicaFlotacion::FisicaFlotacion()
 }
 
 FisicaFlotacion::FisicaFlotacion(float densidad)
-    : densidadObjeto(densidad),
+    : ComponenteFisica(TipoFisica::FLOTACION),
+    densidadObjeto(densidad),
     densidadAgua(1.0f),
     gravedad(9.8f),
     velocidadTerminal(100.0f),
@@ -25,6 +28,16 @@ FisicaFlotacion::~FisicaFlotacion() {
     // Destructor vacio
 }
 
+// ========== MEMORIA ==========
+
+void* FisicaFlotacion::operator new(std::size_t tamanio) {
+    return PoolObjetos<FisicaFlotacion>::reservarMemoria(tamanio);
+}
+
+void FisicaFlotacion::operator delete(void* memoria, std::size_t tamanio) {
+    PoolObjetos<FisicaFlotacion>::liberarMemoria(memoria, tamanio);
+}
+
 // ========== CALCULO DE LA FISICA ==========
 
 float FisicaFlotacion::calcularAceleracion() const {
@@ -77,7 +90,7 @@ Vector2D FisicaFlotacion::calcular(Entidad* e, float dt) {
     return nuevaPosicion;
 }
 
-void FisicaFlotacion::aplicar(Entidad* e) {
+void FisicaFlotacion::aplicar(Entidad* e, float dt) {
     if (!e) return;
 
     // Calcular aceleracion
@@ -85,7 +98,7 @@ void FisicaFlotacion::aplicar(Entidad* e) {
 
     // Obtener y actualizar velocidad
     Vector2D velocidad = e->getVelocidad();
-    velocidad.y += aceleracion * 0.016f; // Asumiendo ~60 FPS
+    velocidad.y += aceleracion * dt;
     velocidad *= friccion;
 
     // Limitar velocidad terminal
@@ -100,7 +113,7 @@ void FisicaFlotacion::aplicar(Entidad* e) {
 
     // Actualizar posicion
     Vector2D posicion = e->getPosicion();
-    posicion += velocidad * 0.016f;
+    posicion += velocidad * dt;
     e->setPosicion(posicion);
 }
 
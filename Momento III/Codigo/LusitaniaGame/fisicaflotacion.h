@@ -3,6 +3,7 @@
 
 #include "componentefisica.h"
 #include "entidad.h"
+#include <cstddef>
 
 // Fisica de Flotacion (Principio de Arquimedes)
 // Usado para: Escombros flotando/hundiendose (Nivel 3)
@@ -14,7 +15,7 @@
 //   - Metal: ρ = 7.8 (se hunde rapido)
 //   - Salvavidas: ρ = 0.3 (flota muy rapido)
 //   - Neutro: ρ = 1.0 (flotacion neutra)
-class FisicaFlotacion : public ComponenteFisica {
+class FisicaFlotacion final : public ComponenteFisica {
 private:
     float densidadObjeto;        // ρ_objeto (rho)
     float densidadAgua;          // ρ_agua = 1.0
@@ -31,9 +32,14 @@ public:
     FisicaFlotacion(float densidad);
     ~FisicaFlotacion();
 
+    // ========== MEMORIA ==========
+    // Se crean y destruyen muy seguido: usan un pool en vez del heap
+    static void* operator new(std::size_t tamanio);
+    static void operator delete(void* memoria, std::size_t tamanio);
+
     // ========== METODOS HEREDADOS ==========
     Vector2D calcular(Entidad* e, float dt) override;
-    void aplicar(Entidad* e) override;
+    void aplicar(Entidad* e, float dt) override;
 
     // ========== GETTERS Y SETTERS ==========
     float getDensidadObjeto() const;
@@ -1,4 +1,15 @@
 #include "fisicavortice.h"
+#include "poolobjetos.h"
+
+// SIMD segun lo que habilite el compilador (-mavx / CONFIG+=avx para AVX;
+// SSE2 viene siempre en x86-64). En otras arquitecturas: solo escalar.
+#if defined(__AVX__)
+#include <immintrin.h>
+#define VORTICE_LOTE_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VORTICE_LOTE_SSE2
+#endif
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -7,7 +18,8 @@
 // ========== CONSTRUCTORES ==========
 
 FisicaVortice::FisicaVortice()
-    : radioInicial(150.0f),              // Radio inicial de 150 pixeles
+    : ComponenteFisica(TipoFisica::VORTICE),
+    radioInicial(150.0f),              // Radio inicial de 150 pixeles
     radioActual(150.0f),
     constanteDecaimiento(0.15f),       // Decae 15% por segundo
     fuerzaMaxima(300.0f),              // Fuerza maxima de succion
@@ -20,7 +32,8 @@ FisicaVortice::FisicaVortice()
 }
 
 FisicaVortice::FisicaVortice(const Vector2D& centro, float R0, float k)
-    : radioInicial(R0),
+    : ComponenteFisica(TipoFisica::VORTICE),
+    radioInicial(R0),
     radioActual(R0),
     constanteDecaimiento(k),
     fuerzaMaxima(300.0f),
@@ -36,6 +49,16 @@ FisicaVortice::~FisicaVortice() {
     // Destructor vacio
 }
 
+// ========== MEMORIA ==========
+
+void* FisicaVortice::operator new(std::size_t tamanio) {
+    return PoolObjetos<FisicaVortice>::reservarMemoria(tamanio);
+}
+
+void FisicaVortice::operator delete(void* memoria, std::size_t tamanio) {
+    PoolObjetos<FisicaVortice>::liberarMemoria(memoria, tamanio);
+}
+
 // ========== CALCULO DE LA FISICA ==========
 
 float FisicaVortice::calcularRadio(float t) const {
@@ -111,7 +134,7 @@ Vector2D FisicaVortice::calcular(Entidad* e, float dt) {
     return nuevaPosicion;
 }
 
-void FisicaVortice::aplicar(Entidad* e) {
+void FisicaVortice::aplicar(Entidad* e, float dt) {
     if (!e || !activo) return;
 
     // Similar a calcular(), pero aplica directamente
@@ -131,14 +154,135 @@ void FisicaVortice::aplicar(Entidad* e) {
 
     // Aplicar a velocidad
     Vector2D velocidad = e->getVelocidad();
-    velocidad += fuerzaTotal * 0.016f; // ~60 FPS
+    velocidad += fuerzaTotal * dt;
     e->setVelocidad(velocidad);
 
     // Aplicar a posicion
-    Vector2D nuevaPosicion = posicionEntidad + velocidad * 0.016f;
+    Vector2D nuevaPosicion = posicionEntidad + velocidad * dt;
     e->setPosicion(nuevaPosicion);
 }
 
+// ========== LOTES (ESTRUCTURA DE ARREGLOS) ==========
+
+void FisicaVortice::aplicarLote(const float* posX, const float* posY,
+                                float* velX, float* velY, size_t n, float dt) const {
+    if (!activo) return;
+
+    aplicarCampoLote(centroPivote, radioActual, fuerzaMaxima, 0.3f,
+                     posX, posY, velX, velY, n, dt);
+}
+
+void FisicaVortice::aplicarCampoLoteEscalar(const Vector2D& centro, float radio, float fuerzaMaxima,
+                                            float fraccionTangencial,
+                                            const float* posX, const float* posY,
+                                            float* velX, float* velY, size_t n, float dt) {
+    if (radio <= 0.0f) return;
+
+    const float inversoRadio = 1.0f / radio;
+
+    for (size_t i = 0; i < n; i++) {
+        float dx = centro.x - posX[i];
+        float dy = centro.y - posY[i];
+        float distancia = std::sqrt(dx * dx + dy * dy);
+
+        // Fuera del radio, o tan cerca del centro que la direccion no sirve
+        if (distancia >= radio || distancia < 1.0f) continue;
+
+        float factor = 1.0f - distancia * inversoRadio;
+        float fuerza = fuerzaMaxima * factor * factor;
+
+        // (dx, dy)/d es la direccion radial y (-dy, dx)/d la tangencial:
+        // se divide una sola vez por d para las dos
+        float escala = fuerza * dt / distancia;
+        velX[i] += (dx - fraccionTangencial * dy) * escala;
+        velY[i] += (dy + fraccionTangencial * dx) * escala;
+    }
+}
+
+void FisicaVortice::aplicarCampoLote(const Vector2D& centro, float radio, float fuerzaMaxima,
+                                     float fraccionTangencial,
+                                     const float* posX, const float* posY,
+                                     float* velX, float* velY, size_t n, float dt) {
+    if (radio <= 0.0f) return;
+
+    size_t i = 0;
+
+    // Las operaciones son las mismas del ciclo escalar y en el mismo orden
+    // (sqrt y division exactas, sin aproximaciones rsqrt/rcp): con o sin
+    // SIMD cada cuerpo recibe la misma velocidad.
+    // En vez de 'continue', una mascara anula la fuerza fuera del radio.
+#if defined(VORTICE_LOTE_AVX)
+    const __m256 cx = _mm256_set1_ps(centro.x);
+    const __m256 cy = _mm256_set1_ps(centro.y);
+    const __m256 r = _mm256_set1_ps(radio);
+    const __m256 invR = _mm256_set1_ps(1.0f / radio);
+    const __m256 fmax = _mm256_set1_ps(fuerzaMaxima);
+    const __m256 ft = _mm256_set1_ps(fraccionTangencial);
+    const __m256 paso = _mm256_set1_ps(dt);
+    const __m256 uno = _mm256_set1_ps(1.0f);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 dx = _mm256_sub_ps(cx, _mm256_loadu_ps(posX + i));
+        __m256 dy = _mm256_sub_ps(cy, _mm256_loadu_ps(posY + i));
+        __m256 d = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+
+        __m256 mascara = _mm256_and_ps(_mm256_cmp_ps(d, r, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(d, uno, _CMP_GE_OQ));
+
+        __m256 factor = _mm256_sub_ps(uno, _mm256_mul_ps(d, invR));
+        __m256 fuerza = _mm256_mul_ps(_mm256_mul_ps(fmax, factor), factor);
+        __m256 escala = _mm256_div_ps(_mm256_mul_ps(fuerza, paso), _mm256_max_ps(d, uno));
+        escala = _mm256_and_ps(escala, mascara);
+
+        __m256 ax = _mm256_mul_ps(_mm256_sub_ps(dx, _mm256_mul_ps(ft, dy)), escala);
+        __m256 ay = _mm256_mul_ps(_mm256_add_ps(dy, _mm256_mul_ps(ft, dx)), escala);
+        _mm256_storeu_ps(velX + i, _mm256_add_ps(_mm256_loadu_ps(velX + i), ax));
+        _mm256_storeu_ps(velY + i, _mm256_add_ps(_mm256_loadu_ps(velY + i), ay));
+    }
+#elif defined(VORTICE_LOTE_SSE2)
+    const __m128 cx = _mm_set1_ps(centro.x);
+    const __m128 cy = _mm_set1_ps(centro.y);
+    const __m128 r = _mm_set1_ps(radio);
+    const __m128 invR = _mm_set1_ps(1.0f / radio);
+    const __m128 fmax = _mm_set1_ps(fuerzaMaxima);
+    const __m128 ft = _mm_set1_ps(fraccionTangencial);
+    const __m128 paso = _mm_set1_ps(dt);
+    const __m128 uno = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 dx = _mm_sub_ps(cx, _mm_loadu_ps(posX + i));
+        __m128 dy = _mm_sub_ps(cy, _mm_loadu_ps(posY + i));
+        __m128 d = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+
+        __m128 mascara = _mm_and_ps(_mm_cmplt_ps(d, r), _mm_cmpge_ps(d, uno));
+
+        __m128 factor = _mm_sub_ps(uno, _mm_mul_ps(d, invR));
+        __m128 fuerza = _mm_mul_ps(_mm_mul_ps(fmax, factor), factor);
+        __m128 escala = _mm_div_ps(_mm_mul_ps(fuerza, paso), _mm_max_ps(d, uno));
+        escala = _mm_and_ps(escala, mascara);
+
+        __m128 ax = _mm_mul_ps(_mm_sub_ps(dx, _mm_mul_ps(ft, dy)), escala);
+        __m128 ay = _mm_mul_ps(_mm_add_ps(dy, _mm_mul_ps(ft, dx)), escala);
+        _mm_storeu_ps(velX + i, _mm_add_ps(_mm_loadu_ps(velX + i), ax));
+        _mm_storeu_ps(velY + i, _mm_add_ps(_mm_loadu_ps(velY + i), ay));
+    }
+#endif
+
+    // Resto (o todo, sin SIMD)
+    aplicarCampoLoteEscalar(centro, radio, fuerzaMaxima, fraccionTangencial,
+                            posX + i, posY + i, velX + i, velY + i, n - i, dt);
+}
+
+const char* FisicaVortice::getInstruccionesLote() {
+#if defined(VORTICE_LOTE_AVX)
+    return "AVX";
+#elif defined(VORTICE_LOTE_SSE2)
+    return "SSE2";
+#else
+    return "escalar";
+#endif
+}
+
 // ========== ACTUALIZACION ==========
 
 void FisicaVortice::actualizar(float dt) {
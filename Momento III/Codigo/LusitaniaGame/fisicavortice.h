@@ -4,6 +4,7 @@
 #include "componentefisica.h"
 #include "entidad.h"
 #include <cmath>
+#include <cstddef>
 
 // Fisica de Vortice (Remolinos submarinos)
 // Usado para: Vortices peligrosos (Nivel 3)
@@ -11,7 +12,7 @@
 //   R(t) = R₀ × e^(-kt)         - Radio decae exponencialmente
 //   F = F_max × (1 - d/R₀)²     - Fuerza segun distancia
 //   ω = 2π/3 rad/s              - Velocidad angular de giro
-class FisicaVortice : public ComponenteFisica {
+class FisicaVortice final : public ComponenteFisica {
 private:
     float radioInicial;         // R₀ - Radio inicial (150 pixeles)
     float radioActual;          // R(t) - Radio en el tiempo actual
@@ -35,9 +36,40 @@ public:
     FisicaVortice(const Vector2D& centro, float R0, float k);
     ~FisicaVortice();
 
+    // ========== MEMORIA ==========
+    // Se crean y destruyen muy seguido: usan un pool en vez del heap
+    static void* operator new(std::size_t tamanio);
+    static void operator delete(void* memoria, std::size_t tamanio);
+
     // ========== METODOS HEREDADOS ==========
     Vector2D calcular(Entidad* e, float dt) override;
-    void aplicar(Entidad* e) override;
+    void aplicar(Entidad* e, float dt) override;
+
+    // ========== LOTES (ESTRUCTURA DE ARREGLOS) ==========
+    // Misma fuerza que aplicar() (radial + 30% tangencial) para n cuerpos
+    // guardados en arreglos: solo cambia las velocidades, la integracion
+    // de la posicion es de quien guarda los arreglos.
+    void aplicarLote(const float* posX, const float* posY,
+                     float* velX, float* velY, size_t n, float dt) const;
+
+    // Campo generico de vortice sobre un lote:
+    //   F = F_max × (1 - d/radio)²  para 1 <= d < radio
+    //   v += (direccion + fraccionTangencial × perpendicular) × F × dt
+    // Usa AVX (8 cuerpos por instruccion) o SSE2 (4) si el compilador
+    // los tiene habilitados, y el ciclo escalar para el resto.
+    static void aplicarCampoLote(const Vector2D& centro, float radio, float fuerzaMaxima,
+                                 float fraccionTangencial,
+                                 const float* posX, const float* posY,
+                                 float* velX, float* velY, size_t n, float dt);
+
+    // Version solo escalar (referencia y comparacion en benchmarks/)
+    static void aplicarCampoLoteEscalar(const Vector2D& centro, float radio, float fuerzaMaxima,
+                                        float fraccionTangencial,
+                                        const float* posX, const float* posY,
+                                        float* velX, float* velY, size_t n, float dt);
+
+    // Instrucciones que usa aplicarCampoLote: "AVX", "SSE2" o "escalar"
+    static const char* getInstruccionesLote();
 
     // ========== ACTUALIZACION ==========
     void actualizar(float dt);
@@ -1,262 +1,296 @@
 #include "gamewidget.h"
-#include "jugador.h"
-#include "nivel3submarino.h"
 #include "gestorsonidos.h"
+#include "perfilador.h"
+#include "vistaopengl.h"
+#include <QDebug>
 #include <QPainter>
+#include <QPixmap>
+#include <QResizeEvent>
+#include <QVBoxLayout>
+
+BackendRender GameWidget::backendInicial = BackendRender::QPAINTER;
+bool GameWidget::simulacionEnHilo = true;
 
 // ========== CONSTRUCTOR ==========
 
 GameWidget::GameWidget(QWidget* parent)
     : QWidget(parent),
-    motorJuego(nullptr),
-    timer(nullptr),
+    simulacion(nullptr),
+    hiloSimulacion(nullptr),
     deltaTime(0.0f),
     fps(0),
-    fpsObjetivo(60),
+    frecuenciaSimulacion(60),
+    maxSubpasos(5),
     hud(nullptr),
-    juegoIniciado(false) {
+    ultimaInstantanea(0),
+    cargaPintada(-1),
+    repintarCompleto(true),
+    vistaGL(nullptr) {
 
     setFocusPolicy(Qt::StrongFocus);
     setMinimumSize(800, 600);
 
-    motorJuego = MotorJuego::obtenerInstancia();
     hud = new HUD();
 
-    timer = new QTimer(this);
-    connect(timer, &QTimer::timeout, this, &GameWidget::actualizar);
-
-    int intervalo = 1000 / fpsObjetivo;
-    timer->setInterval(intervalo);
+    // ===== SIMULACION =====
+    // Entre hilos las señales llegan en cola, en el orden en que salieron
+    simulacion = new SimulacionJuego();
+    connect(simulacion, &SimulacionJuego::instantaneaLista, this, &GameWidget::recibirInstantanea);
+    connect(simulacion, &SimulacionJuego::victoria, this, &GameWidget::victoria);
+    connect(simulacion, &SimulacionJuego::derrota, this, &GameWidget::derrota);
+    connect(simulacion, &SimulacionJuego::pausaCambiada, this, &GameWidget::cambiarPausa);
+    connect(simulacion, &SimulacionJuego::musicaNivel, this, &GameWidget::ponerMusicaNivel);
+    connect(simulacion, &SimulacionJuego::volvioAlMenu, this, &GameWidget::finDelJuego);
+
+    if (simulacionEnHilo) {
+        if (pixmapsEnHilos()) {
+            hiloSimulacion = new QThread(this);
+            hiloSimulacion->setObjectName("simulacion");
+            simulacion->moveToThread(hiloSimulacion);
+            connect(hiloSimulacion, &QThread::finished, simulacion, &QObject::deleteLater);
+            hiloSimulacion->start();
+        } else {
+            qWarning() << "[GameWidget] La plataforma no permite QPixmap en otros hilos:"
+                       << "la simulacion corre en el hilo de la GUI";
+        }
+    }
 
     tiempoFrame.start();
+
+    if (backendInicial == BackendRender::OPENGL) {
+        vistaGL = new VistaOpenGL(this);
+
+        QVBoxLayout* layout = new QVBoxLayout(this);
+        layout->setContentsMargins(0, 0, 0, 0);
+        layout->addWidget(vistaGL);
+
+        // En cola: la señal sale de initializeGL de la misma vista
+        connect(vistaGL, &VistaOpenGL::noDisponible, this, &GameWidget::usarQPainter, Qt::QueuedConnection);
+    }
+
+    actualizarDestino();
 }
 
 GameWidget::~GameWidget() {
-    if (timer) {
-        timer->stop();
-        delete timer;
-        timer = nullptr;
+    // El motor y su nivel se destruyen en el hilo que los uso
+    if (hiloSimulacion) {
+        QMetaObject::invokeMethod(simulacion, [this]() { simulacion->detener(); },
+                                  Qt::BlockingQueuedConnection);
+        hiloSimulacion->quit();
+        hiloSimulacion->wait();     // finished -> deleteLater de la simulacion
+    } else {
+        simulacion->detener();
+        delete simulacion;
     }
+    simulacion = nullptr;
 
     if (hud) {
         delete hud;
         hud = nullptr;
     }
+}
 
-    motorJuego = nullptr;
+bool GameWidget::pixmapsEnHilos() {
+    // Los niveles dibujan QPixmap (atlas, capas estaticas). Fuera del hilo
+    // de la GUI solo se puede si la plataforma los hace raster (X11,
+    // Wayland, Windows, macOS); si no, Qt devuelve un QPixmap nulo
+    bool admitidos = false;
+    QThread* prueba = QThread::create([&admitidos]() {
+        admitidos = !QPixmap(1, 1).isNull();
+    });
+    prueba->start();
+    prueba->wait();
+    delete prueba;
+
+    return admitidos;
 }
 
 // ========== CONTROL DEL JUEGO ==========
+// Todo corre en el hilo de la simulacion; aqui solo se encarga
 
 void GameWidget::iniciarJuego(int nivel) {
-    if (!motorJuego) return;
-
-    motorJuego->cargarNivel(nivel);
-
-    timer->start();
-    juegoIniciado = true;
-
-    tiempoFrame.restart();
+    QMetaObject::invokeMethod(simulacion, [this, nivel]() { simulacion->iniciar(nivel); });
+    repintarCompleto = true;
 }
 
 void GameWidget::pausarJuego() {
-    if (motorJuego) {
-        motorJuego->pausar();
-        GestorSonidos::obtenerInstancia()->pausarMusica();
-    }
+    QMetaObject::invokeMethod(simulacion, [this]() { simulacion->pausar(); });
 }
 
 void GameWidget::reanudarJuego() {
-    if (motorJuego) {
-        motorJuego->reanudar();
-        GestorSonidos::obtenerInstancia()->reanudarMusica();
-    }
+    QMetaObject::invokeMethod(simulacion, [this]() { simulacion->reanudar(); });
 }
 
-void GameWidget::reiniciarJuego() {
-    if (motorJuego) {
-        motorJuego->reiniciarNivel();
+void GameWidget::alternarPausa() {
+    QMetaObject::invokeMethod(simulacion, [this]() { simulacion->alternarPausa(); });
+}
 
-        int nivelActual = motorJuego->getNumeroNivelActual();
-        QString musicaNivel = QString("nivel%1").arg(nivelActual);
-        GestorSonidos::obtenerInstancia()->reproducirMusica(musicaNivel);
-    }
+void GameWidget::reiniciarJuego() {
+    QMetaObject::invokeMethod(simulacion, [this]() { simulacion->reiniciar(); });
+    repintarCompleto = true;
 }
 
 void GameWidget::volverAlMenu() {
-    timer->stop();
-    juegoIniciado = false;
-
-    if (motorJuego) {
-        motorJuego->volverAlMenu();
-    }
-
-    teclasPresionadas.clear();
+    QMetaObject::invokeMethod(simulacion, [this]() { simulacion->volverAlMenu(); });
     GestorSonidos::obtenerInstancia()->reproducirMusica("menu");
 }
 
-// ========== BUCLE PRINCIPAL ==========
+// ========== SLOTS DE LA SIMULACION ==========
 
-void GameWidget::actualizar() {
-    if (!motorJuego || !juegoIniciado) return;
+void GameWidget::recibirInstantanea() {
+    // Antes de tomarla: lo que se publique despues vuelve a avisar
+    simulacion->avisoAtendido();
+    if (!simulacion->tomarInstantanea()) return;
 
-    deltaTime = tiempoFrame.elapsed() / 1000.0f;
+    // Tiempo real entre instantaneas dibujadas (el FPS del HUD)
+    deltaTime = tiempoFrame.nsecsElapsed() / 1.0e9f;
     tiempoFrame.restart();
 
     if (deltaTime > 0.0f) {
         fps = (int)(1.0f / deltaTime);
     }
 
-    procesarInput();
+    // El frame anterior de la GUI termina aqui (este hilo solo mide RENDER)
+    Perfilador::delHilo().cerrarFrame(deltaTime * 1000.0f);
 
-    motorJuego->actualizar(deltaTime);
+    solicitarRepintado();
+}
 
-    Nivel* nivel = motorJuego->getNivelActual();
-    if (nivel) {
-        if (nivel->estaCompletado()) {
-            timer->stop();
+void GameWidget::cambiarPausa(bool pausado) {
+    if (pausado) {
+        GestorSonidos::obtenerInstancia()->pausarMusica();
+    } else {
+        GestorSonidos::obtenerInstancia()->reanudarMusica();
+        repintarCompleto = true;
+    }
+}
 
-            int puntos = nivel->getPuntuacion();
-            int nivelNum = motorJuego->getNumeroNivelActual();
+void GameWidget::ponerMusicaNivel(int nivel) {
+    QString musicaNivel = QString("nivel%1").arg(nivel);
+    GestorSonidos::obtenerInstancia()->reproducirMusica(musicaNivel);
+}
 
-            emit victoria(puntos, nivelNum);
+void GameWidget::finDelJuego() {
+    GestorSonidos::obtenerInstancia()->reproducirMusica("menu");
+}
 
-            motorJuego->siguienteNivel();
+// ========== REPINTADO ==========
 
-            if (motorJuego->getEstado() == EstadoJuego::VICTORIA) {
-                volverAlMenu();
-            } else {
-                int siguienteNivel = motorJuego->getNumeroNivelActual();
-                QString musicaNivel = QString("nivel%1").arg(siguienteNivel);
-                GestorSonidos::obtenerInstancia()->reproducirMusica(musicaNivel);
+void GameWidget::solicitarRepintado() {
+    const Instantanea& instantanea = simulacion->getInstantanea();
 
-                timer->start();
-            }
-        }
+    // Si la simulacion publico dos veces entre avisos, la region de la
+    // instantanea salteada no esta en esta: repintar todo
+    bool seguida = instantanea.numero == ultimaInstantanea + 1;
+    ultimaInstantanea = instantanea.numero;
 
-        // ===== VERIFICAR DERROTA CON DELAY PARA ANIMACION =====
-        if (nivel->haFallado()) {
-            Jugador* jugador = nivel->getJugador();
-
-            // Si es nivel 3 y el jugador esta en animacion de muerte, esperar
-            Nivel3Submarino* nivel3 = dynamic_cast<Nivel3Submarino*>(nivel);
-            if (nivel3 && jugador && jugador->estaEnAnimacionMuerte()) {
-                // Esperar 3 segundos para que termine la animacion
-                if (jugador->getTiempoMuerte() >= 3.0f) {
-                    timer->stop();
-                    int puntos = nivel->getPuntuacion();
-                    int nivelNum = motorJuego->getNumeroNivelActual();
-                    emit derrota(puntos, nivelNum);
-                }
-            } else {
-                // Otros niveles o muerte inmediata
-                timer->stop();
-                int puntos = nivel->getPuntuacion();
-                int nivelNum = motorJuego->getNumeroNivelActual();
-                emit derrota(puntos, nivelNum);
-            }
-        }
+    // OpenGL redibuja todo el frame: sin regiones sucias
+    if (vistaGL) {
+        vistaGL->update();
+        repintarCompleto = false;
+        cargaPintada = instantanea.carga;
+        return;
     }
 
-    update();
+    // La pausa y el perfilador cubren la pantalla; un nivel nuevo no
+    // tiene nada pintado todavia
+    if (!instantanea.parcial || !seguida || repintarCompleto ||
+        instantanea.carga != cargaPintada || instantanea.pausado ||
+        instantanea.conPerfilador) {
+        update();
+    } else {
+        update(instantanea.regionSucia + hud->getRegion(instantanea.hud));
+    }
+
+    repintarCompleto = false;
+    cargaPintada = instantanea.carga;
 }
 
-// ========== PROCESAMIENTO DE INPUT ==========
+void GameWidget::actualizarDestino() {
+    bool enLote = vistaGL != nullptr;
+    QSize tamano = size();
+    qreal escala = devicePixelRatioF();
 
-void GameWidget::procesarInput() {
-    if (!motorJuego) return;
+    QMetaObject::invokeMethod(simulacion, [this, enLote, tamano, escala]() {
+        simulacion->setDestino(enLote, tamano, escala);
+    });
+}
 
-    Nivel* nivel = motorJuego->getNivelActual();
-    if (!nivel) return;
+// ========== RENDER ==========
 
-    Jugador* jugador = nivel->getJugador();
-    if (!jugador) return;
+void GameWidget::setBackendInicial(BackendRender backend) {
+    backendInicial = backend;
+}
 
-    // Pausa
-    if (teclasPresionadas.contains(Qt::Key_P)) {
-        if (motorJuego->getEstado() == EstadoJuego::JUGANDO) {
-            pausarJuego();
-        } else if (motorJuego->getEstado() == EstadoJuego::PAUSADO) {
-            reanudarJuego();
-        }
-        teclasPresionadas.remove(Qt::Key_P);
-    }
+BackendRender GameWidget::getBackend() const {
+    return vistaGL ? BackendRender::OPENGL : BackendRender::QPAINTER;
+}
 
-    manejarMovimientoJugador();
+void GameWidget::setSimulacionEnHilo(bool enHilo) {
+    simulacionEnHilo = enHilo;
 }
 
-void GameWidget::manejarMovimientoJugador() {
-    if (!motorJuego) return;
+void GameWidget::usarQPainter() {
+    if (!vistaGL) return;
 
-    Nivel* nivel = motorJuego->getNivelActual();
-    if (!nivel) return;
+    qWarning() << "[GameWidget] OpenGL no disponible, se dibuja con QPainter";
+    vistaGL->hide();
+    vistaGL->deleteLater();
+    vistaGL = nullptr;
 
-    Jugador* jugador = nivel->getJugador();
-    if (!jugador) return;
+    actualizarDestino();
 
-    // No permitir movimiento si esta muriendo
-    if (jugador->estaEnAnimacionMuerte()) {
-        return;
-    }
+    repintarCompleto = true;
+    update();
+}
 
-    // Verificar si los controles estan bloqueados (Nivel 3)
-    Nivel3Submarino* nivel3 = dynamic_cast<Nivel3Submarino*>(nivel);
-    if (nivel3 && nivel3->estanControlsBloqueados()) {
-        // Controles bloqueados por vortice - NO permitir input
-        return;
-    }
+void GameWidget::dibujarNivel(QPainter& painter) {
+    const Instantanea& instantanea = simulacion->getInstantanea();
+    if (!instantanea.iniciado) return;
 
-    // Vector de direccion
-    Vector2D direccion(0, 0);
+    // Grabada como lote justo antes de volver a QPainter: la siguiente
+    // ya viene en QPicture
+    if (instantanea.enLote) return;
 
-    // WASD / Flechas para movimiento
-    if (teclasPresionadas.contains(Qt::Key_W) ||
-        teclasPresionadas.contains(Qt::Key_Up)) {
-        direccion.y -= 1.0f;
-    }
+    painter.drawPicture(0, 0, instantanea.escena);
+}
 
-    if (teclasPresionadas.contains(Qt::Key_S) ||
-        teclasPresionadas.contains(Qt::Key_Down)) {
-        direccion.y += 1.0f;
-    }
+const LoteDibujo* GameWidget::getLoteNivel() const {
+    const Instantanea& instantanea = simulacion->getInstantanea();
+    return (instantanea.iniciado && instantanea.enLote) ? &instantanea.lote : nullptr;
+}
 
-    if (teclasPresionadas.contains(Qt::Key_A) ||
-        teclasPresionadas.contains(Qt::Key_Left)) {
-        direccion.x -= 1.0f;
-    }
+void GameWidget::dibujarInterfaz(QPainter& painter) {
+    const Instantanea& instantanea = simulacion->getInstantanea();
 
-    if (teclasPresionadas.contains(Qt::Key_D) ||
-        teclasPresionadas.contains(Qt::Key_Right)) {
-        direccion.x += 1.0f;
+    if (!instantanea.iniciado) {
+        painter.fillRect(rect(), QColor(20, 20, 40));
+        painter.setPen(Qt::white);
+        painter.setFont(QFont("Arial", 24, QFont::Bold));
+        painter.drawText(rect(), Qt::AlignCenter,
+                         "El Naufragio del Lusitania\n\nPresiona M para Menu");
+        return;
     }
 
-    // ===== PARA NIVEL 3: AGREGAR A LA VELOCIDAD EN LUGAR DE SOBRESCRIBIR =====
-    if (nivel3) {
-        if (direccion.magnitud() > 0.0f) {
-            Vector2D direccionNorm = direccion.normalizado();
-            Vector2D velocidadDeseada = direccionNorm * jugador->getVelocidadBase();
+    if (!instantanea.hud.valido) return;
 
-            // En nivel 3, sumamos a la velocidad actual (para que los vortices afecten)
-            Vector2D velActual = jugador->getVelocidad();
-            Vector2D nuevaVel = velActual * 0.85f + velocidadDeseada * 0.15f;  // Blend suave
-            jugador->setVelocidad(nuevaVel);
-        } else {
-            // Si no hay input, aplicar friccion
-            Vector2D velActual = jugador->getVelocidad();
-            jugador->setVelocidad(velActual * 0.92f);
-        }
-    } else {
-        // Otros niveles: comportamiento normal
-        if (direccion.magnitud() > 0.0f) {
-            jugador->mover(direccion, deltaTime);
-        } else {
-            jugador->detener();
+    if (hud) {
+        hud->renderizar(painter, instantanea.hud, fps);
+
+        // F3: tiempos por seccion y grafica de frames. Lo medido en la
+        // simulacion viene en la instantanea; RENDER se mide aqui
+        if (instantanea.conPerfilador) {
+            perfiladorVista = instantanea.perfilador;
+            perfiladorVista.copiarSeccion(SeccionPerfil::RENDER, Perfilador::delHilo());
+            hud->renderizarPerfilador(painter, perfiladorVista);
         }
     }
 
-    // Habilidad especial (Shift)
-    if (teclasPresionadas.contains(Qt::Key_Shift)) {
-        jugador->usarHabilidad();
+    if (instantanea.pausado) {
+        painter.fillRect(rect(), QColor(0, 0, 0, 150));
+        painter.setPen(Qt::white);
+        painter.setFont(QFont("Arial", 36, QFont::Bold));
+        painter.drawText(rect(), Qt::AlignCenter, "PAUSA\n\nPresiona P para continuar");
     }
 }
 
@@ -265,61 +299,46 @@ void GameWidget::manejarMovimientoJugador() {
 void GameWidget::paintEvent(QPaintEvent* event) {
     Q_UNUSED(event);
 
+    // Con OpenGL dibuja la vista que cubre el widget
+    if (vistaGL) return;
+
+    TemporizadorPerfil t(SeccionPerfil::RENDER);
+
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
 
-    if (!juegoIniciado || !motorJuego) {
-        painter.fillRect(rect(), QColor(20, 20, 40));
-        painter.setPen(Qt::white);
-        painter.setFont(QFont("Arial", 24, QFont::Bold));
-        painter.drawText(rect(), Qt::AlignCenter,
-                         "El Naufragio del Lusitania\n\nPresiona M para Menu");
-        return;
-    }
-
-    Nivel* nivel = motorJuego->getNivelActual();
-    if (nivel) {
-        nivel->renderizar(painter);
+    dibujarNivel(painter);
+    dibujarInterfaz(painter);
+}
 
-        if (hud) {
-            hud->renderizar(painter, nivel, fps);
-        }
+void GameWidget::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
 
-        if (motorJuego->estaPausado()) {
-            painter.fillRect(rect(), QColor(0, 0, 0, 150));
-            painter.setPen(Qt::white);
-            painter.setFont(QFont("Arial", 36, QFont::Bold));
-            painter.drawText(rect(), Qt::AlignCenter, "PAUSA\n\nPresiona P para continuar");
-        }
-    }
+    // El lote de OpenGL se graba del tamaño de la vista
+    actualizarDestino();
 }
 
 void GameWidget::keyPressEvent(QKeyEvent* event) {
     if (event->isAutoRepeat()) return;
 
     int tecla = event->key();
-    teclasPresionadas.insert(tecla);
 
-    if (motorJuego) {
-        Nivel* nivel = motorJuego->getNivelActual();
-        if (nivel) {
-            nivel->manejarInput(tecla, true);
-        }
+    if (tecla == Qt::Key_F3) {
+        // Uno por hilo: el de la simulacion mide el tick, este el RENDER
+        Perfilador::delHilo().alternar();
+        QMetaObject::invokeMethod(simulacion, [this]() { simulacion->alternarPerfilador(); });
+        repintarCompleto = true;
+        return;
     }
+
+    QMetaObject::invokeMethod(simulacion, [this, tecla]() { simulacion->teclaPresionada(tecla); });
 }
 
 void GameWidget::keyReleaseEvent(QKeyEvent* event) {
     if (event->isAutoRepeat()) return;
 
     int tecla = event->key();
-    teclasPresionadas.remove(tecla);
-
-    if (motorJuego) {
-        Nivel* nivel = motorJuego->getNivelActual();
-        if (nivel) {
-            nivel->manejarInput(tecla, false);
-        }
-    }
+    QMetaObject::invokeMethod(simulacion, [this, tecla]() { simulacion->teclaSoltada(tecla); });
 }
 
 // ========== GETTERS ==========
@@ -331,3 +350,29 @@ int GameWidget::getFPS() const {
 float GameWidget::getDeltaTime() const {
     return deltaTime;
 }
+
+int GameWidget::getFrecuenciaSimulacion() const {
+    return frecuenciaSimulacion;
+}
+
+int GameWidget::getMaxSubpasos() const {
+    return maxSubpasos;
+}
+
+// ========== PASO FIJO ==========
+
+void GameWidget::setFrecuenciaSimulacion(int pasosPorSegundo) {
+    if (pasosPorSegundo <= 0) return;
+
+    frecuenciaSimulacion = pasosPorSegundo;
+    QMetaObject::invokeMethod(simulacion, [this, pasosPorSegundo]() {
+        simulacion->setFrecuenciaSimulacion(pasosPorSegundo);
+    });
+}
+
+void GameWidget::setMaxSubpasos(int pasos) {
+    if (pasos < 1) pasos = 1;
+
+    maxSubpasos = pasos;
+    QMetaObject::invokeMethod(simulacion, [this, pasos]() { simulacion->setMaxSubpasos(pasos); });
+}
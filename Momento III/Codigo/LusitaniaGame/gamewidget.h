@@ -2,40 +2,60 @@
 #define GAMEWIDGET_H
 
 #include <QWidget>
-#include <QTimer>
 #include <QKeyEvent>
 #include <QPainter>
 #include <QElapsedTimer>
-#include <QSet>
-#include "motorjuego.h"
+#include <QThread>
+#include "simulacionjuego.h"
 #include "hud.h"
 
+class VistaOpenGL;
+
+// Como se dibuja el juego. QPainter es el de siempre (raster en la CPU)
+// y el respaldo si no hay OpenGL 3.3
+enum class BackendRender {
+    QPAINTER,
+    OPENGL          // Lotes instanciados sobre QOpenGLWidget (VistaOpenGL)
+};
+
+// Ventana del juego: teclado, musica y dibujo. La simulacion corre en
+// SimulacionJuego (en su propio hilo si se puede) y este widget solo
+// dibuja la ultima Instantanea que publico.
 class GameWidget : public QWidget {
     Q_OBJECT
 
 private:
-    // ===== MOTOR DEL JUEGO =====
-    MotorJuego* motorJuego;
+    // ===== SIMULACION =====
+    SimulacionJuego* simulacion;
+    QThread* hiloSimulacion;      // nullptr = en el hilo de la GUI
+    static bool simulacionEnHilo;
 
-    // ===== BUCLE DEL JUEGO =====
-    QTimer* timer;
+    // ===== FRAMES DE LA GUI =====
     QElapsedTimer tiempoFrame;
-    float deltaTime;
+    float deltaTime;              // Tiempo real entre las dos ultimas instantaneas
     int fps;
-    int fpsObjetivo;
+    int frecuenciaSimulacion;
+    int maxSubpasos;
 
     // ===== HUD =====
     HUD* hud;
+    Perfilador perfiladorVista;   // Tabla de la simulacion + RENDER de este hilo
 
-    // ===== INPUT =====
-    QSet<int> teclasPresionadas;
+    // ===== REPINTADO PARCIAL =====
+    quint64 ultimaInstantanea;    // Numero de la ultima tomada
+    int cargaPintada;             // Nivel del ultimo frame (otro = repintar todo)
+    bool repintarCompleto;        // F3, cambio de backend: el proximo frame va completo
 
-    // ===== ESTADO =====
-    bool juegoIniciado;
+    // ===== BACKEND DE RENDER =====
+    static BackendRender backendInicial;
+    VistaOpenGL* vistaGL;         // nullptr = QPainter en paintEvent
 
     // Metodos privados
-    void procesarInput();
-    void manejarMovimientoJugador();
+    // update() de todo, o solo de lo que cambio si la camara esta fija
+    void solicitarRepintado();
+    // Le dice a la simulacion en que formato grabar el nivel
+    void actualizarDestino();
+    static bool pixmapsEnHilos();
 
 public:
     explicit GameWidget(QWidget *parent = nullptr);
@@ -45,12 +65,37 @@ public:
     void iniciarJuego(int nivel);
     void pausarJuego();
     void reanudarJuego();
+    void alternarPausa();
     void reiniciarJuego();
     void volverAlMenu();
 
+    // ========== PASO FIJO ==========
+    void setFrecuenciaSimulacion(int pasosPorSegundo);
+    void setMaxSubpasos(int pasos);
+
+    // ========== HILOS ==========
+    // Se elige al arrancar (main.cpp). Si la plataforma no permite
+    // QPixmap fuera del hilo de la GUI, la simulacion se queda en el
+    static void setSimulacionEnHilo(bool enHilo);
+    bool simulacionEnOtroHilo() const { return hiloSimulacion != nullptr; }
+
+    // ========== RENDER ==========
+    // Se elige al arrancar (main.cpp), antes de crear la ventana
+    static void setBackendInicial(BackendRender backend);
+    BackendRender getBackend() const;
+
+    // Lo que dibuja un frame, para cualquiera de los dos backends:
+    // el nivel (interpolado) y encima HUD, perfilador y pausa
+    void dibujarNivel(QPainter& painter);
+    void dibujarInterfaz(QPainter& painter);
+    // Nivel ya grabado para OpenGL; nullptr = usar dibujarNivel()
+    const LoteDibujo* getLoteNivel() const;
+
     // ========== GETTERS =====
     int getFPS() const;
     float getDeltaTime() const;
+    int getFrecuenciaSimulacion() const;
+    int getMaxSubpasos() const;
 
 signals:
     // ========== SEÑALES ==========
@@ -60,12 +105,18 @@ signals:
 protected:
     // ========== EVENTOS Qt ==========
     void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
     void keyPressEvent(QKeyEvent* event) override;
     void keyReleaseEvent(QKeyEvent* event) override;
 
 private slots:
-    // ========== SLOT DEL BUCLE =====
-    void actualizar();
+    // ========== SLOTS DE LA SIMULACION =====
+    void recibirInstantanea();
+    void cambiarPausa(bool pausado);
+    void ponerMusicaNivel(int nivel);
+    void finDelJuego();
+    // OpenGL no disponible: volver a QPainter
+    void usarQPainter();
 };
 
 #endif // GAMEWIDGET_H
@@ -0,0 +1,73 @@
+#include "generadoraleatorio.h"
+#include <chrono>
+#include <random>
+
+// ========== CONSTRUCTOR ==========
+
+GeneradorAleatorio::GeneradorAleatorio(uint64_t s)
+    : estado(0),
+    incremento(1),
+    semilla(s) {
+    setSemilla(s);
+}
+
+// ========== SEMILLA ==========
+
+void GeneradorAleatorio::setSemilla(uint64_t s) {
+    // Inicializacion estandar de PCG32 (pcg32_srandom)
+    // La secuencia se deriva de la semilla para no depender de un segundo valor
+    semilla = s;
+    estado = 0;
+    incremento = ((s ^ 0x9E3779B97F4A7C15ULL) << 1u) | 1u;
+    siguiente();
+    estado += s;
+    siguiente();
+}
+
+uint64_t GeneradorAleatorio::getSemilla() const {
+    return semilla;
+}
+
+uint64_t GeneradorAleatorio::semillaNueva() {
+    std::random_device dispositivo;
+    uint64_t reloj = static_cast<uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+    uint64_t s = (static_cast<uint64_t>(dispositivo()) << 32) ^ reloj;
+    return s != 0 ? s : 1;
+}
+
+GeneradorAleatorio& GeneradorAleatorio::porDefecto() {
+    // Uno por hilo: nunca se comparte estado entre simulaciones paralelas
+    thread_local GeneradorAleatorio generador(1);
+    return generador;
+}
+
+// ========== NUMEROS ==========
+
+uint32_t GeneradorAleatorio::siguiente() {
+    // PCG-XSH-RR: LCG de 64 bits con permutacion de salida
+    uint64_t anterior = estado;
+    estado = anterior * 6364136223846793005ULL + incremento;
+
+    uint32_t mezclado = static_cast<uint32_t>(((anterior >> 18u) ^ anterior) >> 27u);
+    uint32_t rotacion = static_cast<uint32_t>(anterior >> 59u);
+
+    return (mezclado >> rotacion) | (mezclado << ((0u - rotacion) & 31u));
+}
+
+int GeneradorAleatorio::entero(int n) {
+    if (n <= 0) return 0;
+
+    // Multiplicacion en vez de modulo: sin division y sin sesgo apreciable
+    return static_cast<int>((static_cast<uint64_t>(siguiente()) * static_cast<uint64_t>(n)) >> 32);
+}
+
+float GeneradorAleatorio::real() {
+    // 24 bits de mantisa -> [0, 1)
+    return (siguiente() >> 8) * (1.0f / 16777216.0f);
+}
+
+float GeneradorAleatorio::real(float min, float max) {
+    return min + (max - min) * real();
+}
@@ -0,0 +1,37 @@
+#ifndef GENERADORALEATORIO_H
+#define GENERADORALEATORIO_H
+
+#include <cstdint>
+
+// Generador de numeros aleatorios por nivel (PCG32)
+// Reemplaza a rand(): cada Nivel tiene el suyo, asi una misma semilla
+// produce exactamente la misma partida y varios niveles pueden
+// simularse en paralelo sin compartir el estado global de libc.
+class GeneradorAleatorio {
+private:
+    uint64_t estado;        // Estado interno del PCG
+    uint64_t incremento;    // Secuencia (siempre impar)
+    uint64_t semilla;       // Semilla con la que se inicio
+
+public:
+    // ========== CONSTRUCTOR ==========
+    explicit GeneradorAleatorio(uint64_t s = 1);
+
+    // ========== SEMILLA ==========
+    void setSemilla(uint64_t s);
+    uint64_t getSemilla() const;
+
+    // Semilla distinta en cada llamada (reloj + random_device)
+    static uint64_t semillaNueva();
+
+    // Generador del hilo actual, para objetos creados fuera de un nivel
+    static GeneradorAleatorio& porDefecto();
+
+    // ========== NUMEROS ==========
+    uint32_t siguiente();               // 32 bits uniformes
+    int entero(int n);                  // [0, n), como rand() % n
+    float real();                       // [0, 1)
+    float real(float min, float max);   // [min, max)
+};
+
+#endif // GENERADORALEATORIO_H
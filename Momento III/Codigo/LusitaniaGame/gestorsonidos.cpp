@@ -3,12 +3,17 @@
 GestorSonidos* GestorSonidos::instancia = nullptr;
 
 GestorSonidos::GestorSonidos()
-    : volumenMusica(0.5f),
+    : archivoAssets(ArchivoAssets::obtenerCompartido()),
+    bufferMusica(nullptr),
+    volumenMusica(0.5f),
     volumenEfectos(0.7f),
     musicaHabilitada(true),
     efectosHabilitados(true) {
 
-    rutaBase = obtenerRutaSonidos();
+    // Con assets.lpk no se busca la carpeta de sonidos
+    if (!archivoAssets->estaAbierto()) {
+        rutaBase = obtenerRutaSonidos();
+    }
 
     // Crear reproductor de musica
     reproductorMusica = new QMediaPlayer();
@@ -31,6 +36,9 @@ GestorSonidos::~GestorSonidos() {
         salidaMusica = nullptr;
     }
 
+    delete bufferMusica;
+    bufferMusica = nullptr;
+
     // Limpiar efectos
     for (auto* reproductor : reproductoresEfectos) {
         if (reproductor) {
@@ -45,8 +53,13 @@ GestorSonidos::~GestorSonidos() {
         }
     }
 
+    for (auto* buffer : buffersEfectos) {
+        delete buffer;
+    }
+
     reproductoresEfectos.clear();
     salidasEfectos.clear();
+    buffersEfectos.clear();
 }
 
 GestorSonidos* GestorSonidos::obtenerInstancia() {
@@ -94,7 +107,23 @@ QString GestorSonidos::obtenerRutaSonidos() {
     return "";
 }
 
+QBuffer* GestorSonidos::abrirDesdeArchivo(const QString& nombre) {
+    QString clave = "sonidos/" + nombre;
+    if (!archivoAssets->tieneDatos(clave)) return nullptr;
+
+    // setData comparte los bytes del mapa (fromRawData): no copia el MP3
+    QBuffer* buffer = new QBuffer();
+    buffer->setData(archivoAssets->getDatos(clave));
+    buffer->open(QIODevice::ReadOnly);
+    return buffer;
+}
+
 bool GestorSonidos::cargarMusica(const QString& nombre, const QString& archivo) {
+    if (archivoAssets->tieneDatos("sonidos/" + nombre)) {
+        qDebug() << "Musica registrada: " << nombre;
+        return true;
+    }
+
     QString rutaCompleta = rutaBase + archivo;
     QFileInfo checkFile(rutaCompleta);
 
@@ -109,9 +138,9 @@ bool GestorSonidos::cargarMusica(const QString& nombre, const QString& archivo)
 
 bool GestorSonidos::cargarEfecto(const QString& nombre, const QString& archivo) {
     QString rutaCompleta = rutaBase + archivo;
-    QFileInfo checkFile(rutaCompleta);
+    QBuffer* buffer = abrirDesdeArchivo(QFileInfo(archivo).completeBaseName());
 
-    if (!checkFile.exists()) {
+    if (!buffer && !QFileInfo(rutaCompleta).exists()) {
         qDebug() << "Efecto no encontrado: " << rutaCompleta;
         return false;
     }
@@ -121,7 +150,13 @@ bool GestorSonidos::cargarEfecto(const QString& nombre, const QString& archivo)
     QAudioOutput* salida = new QAudioOutput();
     reproductor->setAudioOutput(salida);
     salida->setVolume(volumenEfectos);
-    reproductor->setSource(QUrl::fromLocalFile(rutaCompleta));
+
+    if (buffer) {
+        reproductor->setSourceDevice(buffer, QUrl(archivo));
+        buffersEfectos[nombre] = buffer;
+    } else {
+        reproductor->setSource(QUrl::fromLocalFile(rutaCompleta));
+    }
 
     reproductoresEfectos[nombre] = reproductor;
     salidasEfectos[nombre] = salida;
@@ -151,16 +186,25 @@ void GestorSonidos::cargarTodosLosSonidos() {
 void GestorSonidos::reproducirMusica(const QString& nombre, bool loop) {
     if (!musicaHabilitada || !reproductorMusica) return;
 
+    QBuffer* buffer = abrirDesdeArchivo(nombre);
     QString rutaCompleta = rutaBase + nombre + ".mp3";
-    QFileInfo checkFile(rutaCompleta);
 
-    if (!checkFile.exists()) {
+    if (!buffer && !QFileInfo(rutaCompleta).exists()) {
         qDebug() << "No se puede reproducir musica:" << nombre;
         return;
     }
 
     reproductorMusica->stop();
-    reproductorMusica->setSource(QUrl::fromLocalFile(rutaCompleta));
+
+    if (buffer) {
+        reproductorMusica->setSourceDevice(buffer, QUrl(nombre + ".mp3"));
+    } else {
+        reproductorMusica->setSource(QUrl::fromLocalFile(rutaCompleta));
+    }
+
+    // El buffer anterior se suelta cuando el reproductor ya no lo usa
+    delete bufferMusica;
+    bufferMusica = buffer;
 
     if (loop) {
         reproductorMusica->setLoops(QMediaPlayer::Infinite);
@@ -1,8 +1,10 @@
 #ifndef GESTORSONIDOS_H
 #define GESTORSONIDOS_H
 
+#include "archivoassets.h"
 #include <QMediaPlayer>
 #include <QAudioOutput>
+#include <QBuffer>
 #include <QMap>
 #include <QString>
 #include <QUrl>
@@ -21,6 +23,12 @@ private:
     QMap<QString, QMediaPlayer*> reproductoresEfectos;
     QMap<QString, QAudioOutput*> salidasEfectos;
 
+    // Con assets.lpk los MP3 se leen del mapa en memoria (sin copias);
+    // el mismo archivo que usa GestorSprites
+    const ArchivoAssets* archivoAssets;
+    QBuffer* bufferMusica;
+    QMap<QString, QBuffer*> buffersEfectos;
+
     QString rutaBase;
     float volumenMusica;
     float volumenEfectos;
@@ -30,6 +38,9 @@ private:
     GestorSonidos();
     QString obtenerRutaSonidos();
 
+    // "sonidos/<nombre>" en el archivo; nullptr si no esta
+    QBuffer* abrirDesdeArchivo(const QString& nombre);
+
 public:
     static GestorSonidos* obtenerInstancia();
     static void destruirInstancia();
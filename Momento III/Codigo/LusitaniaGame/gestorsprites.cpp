@@ -1,16 +1,50 @@
 #include "gestorsprites.h"
+#include "lotedibujo.h"
+#include <QCoreApplication>
 #include <QFileInfo>
+#include <QMetaObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QTransform>
+#include <algorithm>
 
 GestorSprites* GestorSprites::instancia = nullptr;
 
-GestorSprites::GestorSprites() {
-    // Obtener ruta relativa de assets
+namespace {
+
+// Nombres internados: compartidos por todos los hilos (las entidades
+// resuelven su sprite al construirse, y la simulacion puede ser paralela)
+QMutex mutexIds;
+QHash<QString, SpriteId> idsPorNombre;
+QVector<QString> nombresPorId;
+
+} // namespace
+
+GestorSprites::GestorSprites()
+    : archivoAssets(ArchivoAssets::obtenerCompartido()),
+    empaquetando(false),
+    escalados(LIMITE_CACHE_MB * 1024) {
+    // Con assets.lpk no se busca ninguna carpeta: un solo archivo mapeado
+    if (archivoAssets->estaAbierto()) {
+        return;
+    }
+
+    // Sin archivo (desarrollo): carpeta suelta, relativa al ejecutable
     rutaBase = obtenerRutaAssets();
     qDebug() << "Ruta base de assets:" << rutaBase;
 }
 
 GestorSprites::~GestorSprites() {
-    sprites.clear();
+    // Esperar las precargas en curso antes de soltar lo demas
+    cargasEnCurso.clear();
+    cargasAbandonadas.clear();
+
+    escalados.clear();
+    paginas.clear();
+    regiones.clear();
+    pendiente.limpiar();
+    paquetesCargados.clear();
     animaciones.clear();
 }
 
@@ -72,29 +106,242 @@ bool GestorSprites::cargarSprite(const QString& nombre, const QString& ruta) {
         return false;
     }
 
-    QPixmap pixmap(ruta);
+    QImage imagen(ruta);
 
-    if (pixmap.isNull()) {
+    if (imagen.isNull()) {
         qDebug() << "Error al cargar sprite: " << ruta;
         return false;
     }
 
-    sprites[nombre] = pixmap;
-    qDebug() << "Sprite cargado: " << nombre << "(" << pixmap.width() << "x" << pixmap.height() << ")";
+    pendiente.agregar(nombre, imagen);
+
+    // Sin un lote abierto el sprite va a su propia pagina ya
+    if (!empaquetando) {
+        cerrarAtlas();
+    }
+
+    qDebug() << "Sprite cargado: " << nombre << "(" << imagen.width() << "x" << imagen.height() << ")";
     return true;
 }
 
+// ========================================
+// IDS DE SPRITE
+// ========================================
+
+SpriteId GestorSprites::idSprite(const QString& nombre) {
+    QMutexLocker bloqueo(&mutexIds);
+
+    auto it = idsPorNombre.constFind(nombre);
+    if (it != idsPorNombre.constEnd()) {
+        return it.value();
+    }
+
+    SpriteId id = nombresPorId.size();
+    idsPorNombre.insert(nombre, id);
+    nombresPorId.append(nombre);
+    return id;
+}
+
+QString GestorSprites::nombreSprite(SpriteId id) {
+    QMutexLocker bloqueo(&mutexIds);
+    return (id >= 0 && id < nombresPorId.size()) ? nombresPorId[id] : QString();
+}
+
 QPixmap GestorSprites::getSprite(const QString& nombre) {
-    if (sprites.contains(nombre)) {
-        return sprites[nombre];
+    QMutexLocker bloqueo(&mutexAtlas);
+    RegionSprite region = getRegion(nombre);
+
+    if (!region.esValida()) {
+        qDebug() << "Sprite no encontrado: " << nombre;
+        return QPixmap();
+    }
+
+    const QPixmap& pagina = paginas[region.pagina];
+    if (region.rect == pagina.rect()) {
+        return pagina;
+    }
+
+    return pagina.copy(region.rect);
+}
+
+// ========================================
+// ATLAS
+// ========================================
+
+void GestorSprites::iniciarAtlas() {
+    empaquetando = true;
+}
+
+void GestorSprites::cerrarAtlas() {
+    empaquetando = false;
+
+    pendiente.empaquetar();
+    integrarAtlas(pendiente, nullptr);
+    pendiente.limpiar();
+}
+
+void GestorSprites::integrarAtlas(AtlasTexturas& atlas, PaqueteCargado* paquete) {
+    QMutexLocker bloqueo(&mutexAtlas);
+
+    // Indice global de cada pagina del atlas: primero los que dejo libres
+    // un paquete descargado, asi el arreglo no crece en cada ida y vuelta
+    // entre el menu y un nivel
+    QVector<int> indices;
+    for (int i = 0; i < atlas.getNumPaginas(); i++) {
+        QPixmap pagina = QPixmap::fromImage(atlas.getPagina(i));
+        int indice;
+
+        if (!paginasLibres.isEmpty()) {
+            indice = paginasLibres.takeLast();
+            paginas[indice] = pagina;
+        } else {
+            indice = paginas.size();
+            paginas.append(pagina);
+        }
+
+        indices.append(indice);
+        if (paquete) {
+            paquete->paginas.append(indice);
+        }
+    }
+
+    // Los pixeles ya estan en los QPixmap: no guardar dos copias
+    atlas.liberarPixeles();
+
+    // Los nombres se internan aqui, una vez por carga; despues todo es por id
+    const QMap<QString, RegionSprite>& nuevas = atlas.getRegiones();
+    for (auto it = nuevas.constBegin(); it != nuevas.constEnd(); ++it) {
+        SpriteId id = idSprite(it.key());
+        if (id >= regiones.size()) {
+            regiones.resize(id + 1);
+        }
+
+        // Recargar un sprite invalida las variantes escaladas del anterior
+        if (regiones[id].esValida()) {
+            escalados.clear();
+        }
+
+        regiones[id] = RegionSprite(indices[it.value().pagina], it.value().rect);
+        if (paquete) {
+            paquete->sprites.append(id);
+        }
+    }
+}
+
+QRect GestorSprites::resolverFuente(const RegionSprite& region, const QRect& recorte) const {
+    if (recorte.isNull()) {
+        return region.rect;
+    }
+
+    // Recorte relativo al sprite; nunca se sale de su region (leeria al vecino)
+    return recorte.translated(region.rect.topLeft()).intersected(region.rect);
+}
+
+void GestorSprites::dibujarRegion(QPainter& painter, const QRectF& destino, const RegionSprite& region) const {
+    if (!region.esValida()) return;
+
+    QMutexLocker bloqueo(&mutexAtlas);
+    painter.drawPixmap(destino, paginas[region.pagina], QRectF(region.rect));
+}
+
+bool GestorSprites::dibujarSprite(QPainter& painter, float x, float y, SpriteId sprite,
+                                  int ancho, int alto, bool volteado,
+                                  Qt::AspectRatioMode modo, const QRect& recorte) {
+    QMutexLocker bloqueo(&mutexAtlas);
+
+    RegionSprite region = getRegion(sprite);
+    if (!region.esValida()) return false;
+
+    QRect fuente = resolverFuente(region, recorte);
+    if (fuente.isEmpty()) return false;
+
+    QSize tamanoFinal = fuente.size().scaled(ancho, alto, modo);
+
+    // En el lote de OpenGL la GPU escala y voltea al muestrear: siempre
+    // directo de la pagina del atlas, sin crear variantes escaladas
+    if (LoteDibujo::esLote(painter)) {
+        QRectF destino(0, 0, tamanoFinal.width(), tamanoFinal.height());
+
+        if (volteado) {
+            painter.save();
+            painter.translate(x + tamanoFinal.width(), y);
+            painter.scale(-1, 1);
+            painter.drawPixmap(destino, paginas[region.pagina], QRectF(fuente));
+            painter.restore();
+        } else {
+            painter.drawPixmap(destino.translated(x, y), paginas[region.pagina], QRectF(fuente));
+        }
+        return true;
+    }
+
+    if (tamanoFinal == fuente.size() && !volteado) {
+        painter.drawPixmap(QPointF(x, y), paginas[region.pagina], QRectF(fuente));
+    } else {
+        painter.drawPixmap(QPointF(x, y), getFrameEscalado(sprite, recorte, ancho, alto, volteado, modo));
+    }
+
+    return true;
+}
+
+// ========================================
+// SPRITES ESCALADOS (CACHE)
+// ========================================
+
+QPixmap GestorSprites::getSpriteEscalado(SpriteId sprite, int ancho, int alto, bool volteado,
+                                         Qt::AspectRatioMode modo) {
+    return getFrameEscalado(sprite, QRect(), ancho, alto, volteado, modo);
+}
+
+QPixmap GestorSprites::getFrameEscalado(SpriteId sprite, const QRect& recorte, int ancho, int alto,
+                                        bool volteado, Qt::AspectRatioMode modo) {
+    if (ancho <= 0 || alto <= 0) return QPixmap();
+
+    ClaveSpriteEscalado clave{sprite, recorte, ancho, alto, volteado, static_cast<int>(modo)};
+
+    QMutexLocker bloqueo(&mutexAtlas);
+
+    if (QPixmap* guardado = escalados.object(clave)) {
+        return *guardado;
+    }
+
+    RegionSprite region = getRegion(sprite);
+    if (!region.esValida()) {
+        return QPixmap();
+    }
+
+    QRect fuente = resolverFuente(region, recorte);
+    if (fuente.isEmpty()) {
+        return QPixmap();
+    }
+
+    // Unica copia fuera del atlas: al crear la variante, no en cada frame
+    QPixmap variante = paginas[region.pagina].copy(fuente);
+    variante = variante.scaled(ancho, alto, modo, Qt::SmoothTransformation);
+
+    if (volteado) {
+        variante = variante.transformed(QTransform().scale(-1, 1));
     }
 
-    qDebug() << "Sprite no encontrado: " << nombre;
-    return QPixmap();
+    // Si la variante sola supera el limite, QCache no la guarda y la borra
+    int costoKB = qMax(1, variante.width() * variante.height() * 4 / 1024);
+    escalados.insert(clave, new QPixmap(variante), costoKB);
+
+    return variante;
+}
+
+void GestorSprites::setLimiteCacheEscalados(int megabytes) {
+    QMutexLocker bloqueo(&mutexAtlas);
+    escalados.setMaxCost(qMax(1, megabytes) * 1024);
 }
 
-bool GestorSprites::tieneSprite(const QString& nombre) {
-    return sprites.contains(nombre);
+int GestorSprites::getMemoriaCacheEscalados() const {
+    QMutexLocker bloqueo(&mutexAtlas);
+    return escalados.totalCost();
+}
+
+void GestorSprites::limpiarCacheEscalados() {
+    QMutexLocker bloqueo(&mutexAtlas);
+    escalados.clear();
 }
 
 bool GestorSprites::cargarAnimacion(const QString& nombre, const QString& rutaCarpeta,
@@ -103,18 +350,29 @@ bool GestorSprites::cargarAnimacion(const QString& nombre, const QString& rutaCa
     anim.tiempoFrame = tiempoFrame;
     anim.loop = true;
 
+    // Cada frame es un sprite mas del atlas: "nombre#00", "nombre#01", ...
+    // Cargada suelta, la animacion igual comparte pagina entre sus frames
+    bool atlasPropio = !empaquetando;
+    if (atlasPropio) {
+        iniciarAtlas();
+    }
+
     for (int i = 0; i < numFrames; i++) {
         QString nombreArchivo = QString("%1%2.png").arg(prefijo).arg(i, 2, 10, QChar('0'));
         QString rutaCompleta = rutaCarpeta + nombreArchivo;
+        QString nombreFrame = QString("%1#%2").arg(nombre).arg(i, 2, 10, QChar('0'));
 
-        QPixmap frame(rutaCompleta);
-        if (!frame.isNull()) {
-            anim.frames.append(frame);
+        if (cargarSprite(nombreFrame, rutaCompleta)) {
+            anim.frames.append(idSprite(nombreFrame));
         } else {
             qDebug() << "Error cargando frame: " << rutaCompleta;
         }
     }
 
+    if (atlasPropio) {
+        cerrarAtlas();
+    }
+
     if (anim.frames.isEmpty()) {
         qDebug() << "No se pudo cargar animacion:" << nombre;
         return false;
@@ -125,10 +383,10 @@ bool GestorSprites::cargarAnimacion(const QString& nombre, const QString& rutaCa
     return true;
 }
 
-QPixmap GestorSprites::getFrameAnimacion(const QString& nombre, float dt) {
+RegionSprite GestorSprites::getFrameAnimacion(const QString& nombre, float dt) {
     if (!animaciones.contains(nombre)) {
         qDebug() << "Animacion no encontrada: " << nombre;
-        return QPixmap();
+        return RegionSprite();
     }
 
     Animacion& anim = animaciones[nombre];
@@ -149,7 +407,7 @@ QPixmap GestorSprites::getFrameAnimacion(const QString& nombre, float dt) {
         }
     }
 
-    return anim.frames[anim.frameActual];
+    return getRegion(anim.frames[anim.frameActual]);
 }
 
 void GestorSprites::reiniciarAnimacion(const QString& nombre) {
@@ -160,97 +418,293 @@ void GestorSprites::reiniciarAnimacion(const QString& nombre) {
 }
 
 // ========================================
-// CARGA DE TODOS LOS SPRITES
+// PAQUETES (CARGA POR NIVEL)
 // ========================================
 
-void GestorSprites::cargarTodosLosSprites() {
-    qDebug() << "\n========================================";
-    qDebug() << "INICIANDO CARGA DE SPRITES";
-    qDebug() << "========================================\n";
+QVector<ArchivoSprite> GestorSprites::archivosPaquete(int paquete, const QString& rutaSprites) {
+    QVector<ArchivoSprite> archivos;
 
-    cargarSpritesNivel1();
-    cargarSpritesNivel2();
-    cargarSpritesNivel3();
-    cargarSpritesUI();
+    switch (paquete) {
+    case PAQUETE_MENU: {
+        QString rutaUI = rutaSprites + "ui/";
 
-    qDebug() << "\n========================================";
-    qDebug() << "CARGA COMPLETADA";
-    qDebug() << "Total sprites:" << sprites.size();
-    qDebug() << "Total animaciones:" << animaciones.size();
-    qDebug() << "========================================\n";
-}
+        // Fondo de menu
+        archivos.append({"menu_fondo", rutaUI + "menu_fondo.jpg"});
+        break;
+    }
+    case 1: {
+        QString rutaNivel1 = rutaSprites + "nivel1/";
 
-void GestorSprites::cargarSpritesNivel1() {
-    qDebug() << "\n=== NIVEL 1: OCEANO ===";
+        // Barco Lusitania
+        archivos.append({"lusitania", rutaNivel1 + "barco/lusitania.png"});
 
-    QString rutaNivel1 = rutaBase + "nivel1/";
+        // Submarino
+        archivos.append({"submarino", rutaNivel1 + "submarino/submarino.png"});
 
-    // Barco Lusitania
-    cargarSprite("lusitania", rutaNivel1 + "barco/lusitania.png");
+        // Torpedo
+        archivos.append({"torpedo", rutaNivel1 + "torpedo/torpedo.png"});
+        break;
+    }
+    case 2: {
+        QString rutaNivel2 = rutaSprites + "nivel2/";
 
-    // Oceano animado (si tienes frames)
-    // cargarAnimacion("oceano", rutaNivel1 + "oceano/", "oceano_", 12, 0.08f);
+        // Escalera
+        archivos.append({"escalera", rutaNivel2 + "escalera/escalera.png"});
 
-    // Submarino
-    cargarSprite("submarino", rutaNivel1 + "submarino/submarino.png");
+        // Fondo
+        archivos.append({"estructura1", rutaNivel2 + "fondo/estructura1.png"});
+        archivos.append({"estructura2", rutaNivel2 + "fondo/estructura2.png"});
 
-    // Torpedo
-    cargarSprite("torpedo", rutaNivel1 + "torpedo/torpedo.png");
+        // NPCs
+        for (int i = 1; i <= 8; i++) {
+            QString numero = QString("%1").arg(i, 2, 10, QChar('0'));
+            archivos.append({"npc_" + numero, rutaNivel2 + "npcs/npc_" + numero + ".png"});
+        }
+        archivos.append({"npc_generico", rutaNivel2 + "npcs/npc_generico.png"});
+
+        // Objetos
+        archivos.append({"cofres", rutaNivel2 + "objetos/cofres.png"});
+        archivos.append({"lamparas", rutaNivel2 + "objetos/lamparas.png"});
+        break;
+    }
+    case 3: {
+        QString rutaNivel3 = rutaSprites + "nivel3/";
+
+        // Escombros
+        archivos.append({"escombro_madera", rutaNivel3 + "escombros/madera.png"});
+        archivos.append({"escombro_metal", rutaNivel3 + "escombros/metal.png"});
+        archivos.append({"escombro_salvavidas", rutaNivel3 + "escombros/salvavidas.png"});
+
+        // Fondo
+        archivos.append({"oceano_profundo", rutaNivel3 + "fondo/oceano_profundo.jpg"});
+
+        // Jugador
+        archivos.append({"jugador_idle", rutaNivel3 + "jugador/jugador_idle.png"});
+        archivos.append({"jugador_swim", rutaNivel3 + "jugador/jugador_swim.png"});
+        archivos.append({"jugador_hurt", rutaNivel3 + "jugador/jugador_hurt.png"});
+        archivos.append({"jugador_death", rutaNivel3 + "jugador/jugador_death.png"});
+
+        // Vortice
+        archivos.append({"vortice", rutaNivel3 + "vortice/vortice.png"});
+        break;
+    }
+    default:
+        break;
+    }
+
+    return archivos;
 }
 
-void GestorSprites::cargarSpritesNivel2() {
-    qDebug() << "\n=== NIVEL 2: BARCO ===";
+AtlasTexturas GestorSprites::decodificarPaquete(QVector<ArchivoSprite> archivos) {
+    // Hilo de trabajo: nada de QPixmap ni de estado del gestor
+    AtlasTexturas atlas;
+
+    for (const ArchivoSprite& archivo : archivos) {
+        QImage imagen(archivo.ruta);
+
+        if (imagen.isNull()) {
+            qDebug() << "Error al cargar sprite: " << archivo.ruta;
+            continue;
+        }
+
+        atlas.agregar(archivo.nombre, imagen);
+    }
+
+    atlas.empaquetar();
+    return atlas;
+}
 
-    QString rutaNivel2 = rutaBase + "nivel2/";
+void GestorSprites::cargarPaquete(int paquete) {
+    if (paquete < 0 || paquete >= NUM_PAQUETES || paqueteCargado(paquete)) return;
 
-    // Escalera
-    cargarSprite("escalera", rutaNivel2 + "escalera/escalera.png");
+    // Fuera de la GUI no se espera ni se crean paginas: solo se pide
+    if (!enHiloGui()) {
+        precargarPaquete(paquete);
+        return;
+    }
 
-    // Fondo
-    cargarSprite("estructura1", rutaNivel2 + "fondo/estructura1.png");
-    cargarSprite("estructura2", rutaNivel2 + "fondo/estructura2.png");
+    // Ya decodificado y encolado: la instalacion encolada lo trae
+    {
+        QMutexLocker bloqueo(&mutexAtlas);
+        if (entregasPendientes.contains(paquete)) return;
+    }
 
-    // NPCs
-    for (int i = 1; i <= 8; i++) {
-        QString nombre = QString("npc_%1").arg(i, 2, 10, QChar('0'));
-        QString ruta = rutaNivel2 + QString("npcs/npc_%1.png").arg(i, 2, 10, QChar('0'));
-        cargarSprite(nombre, ruta);
+    AtlasTexturas atlas;
+
+    auto enCurso = cargasEnCurso.find(paquete);
+    if (enCurso != cargasEnCurso.end()) {
+        // Ya se estaba precargando: esperar solo lo que falte
+        atlas = enCurso->second.get();
+        cargasEnCurso.erase(enCurso);
+    } else if (archivoAssets->tienePaquete(paquete)) {
+        atlas = archivoAssets->leerPaquete(paquete);
+    } else {
+        atlas = decodificarPaquete(archivosPaquete(paquete, rutaBase));
     }
-    cargarSprite("npc_generico", rutaNivel2 + "npcs/npc_generico.png");
 
-    // Objetos
-    cargarSprite("cofres", rutaNivel2 + "objetos/cofres.png");
-    cargarSprite("lamparas", rutaNivel2 + "objetos/lamparas.png");
+    entregarPaquete(paquete, atlas);
 }
 
-void GestorSprites::cargarSpritesNivel3() {
-    qDebug() << "\n=== NIVEL 3: SUBMARINO ===";
+bool GestorSprites::enHiloGui() {
+    // Sin aplicacion (herramientas de consola) el unico hilo hace de GUI
+    return !QCoreApplication::instance() ||
+           QThread::currentThread() == QCoreApplication::instance()->thread();
+}
 
-    QString rutaNivel3 = rutaBase + "nivel3/";
+void GestorSprites::entregarPaquete(int paquete, const AtlasTexturas& atlas) {
+    {
+        QMutexLocker bloqueo(&mutexAtlas);
+        entregasPendientes.insert(paquete);
+    }
 
-    // Escombros
-    cargarSprite("escombro_madera", rutaNivel3 + "escombros/madera.png");
-    cargarSprite("escombro_metal", rutaNivel3 + "escombros/metal.png");
-    cargarSprite("escombro_salvavidas", rutaNivel3 + "escombros/salvavidas.png");
+    if (enHiloGui()) {
+        instalarPaquete(paquete, atlas);
+        return;
+    }
 
-    // Fondo
-    cargarSprite("oceano_profundo", rutaNivel3 + "fondo/oceano_profundo.jpg");
+    // Los QImage se comparten implicitamente: la copia no duplica pixeles
+    QMetaObject::invokeMethod(QCoreApplication::instance(), [this, paquete, atlas]() {
+        instalarPaquete(paquete, atlas);
+    }, Qt::QueuedConnection);
+}
+
+void GestorSprites::instalarPaquete(int paquete, AtlasTexturas atlas) {
+    QMutexLocker bloqueo(&mutexAtlas);
+
+    // Se descargo (cambio de nivel) mientras esperaba: se descarta
+    if (!entregasPendientes.remove(paquete)) return;
 
-    // Jugador
-    cargarSprite("jugador_idle", rutaNivel3 + "jugador/jugador_idle.png");
-    cargarSprite("jugador_swim", rutaNivel3 + "jugador/jugador_swim.png");
-    cargarSprite("jugador_hurt", rutaNivel3 + "jugador/jugador_hurt.png");
-    cargarSprite("jugador_death", rutaNivel3 + "jugador/jugador_death.png");
+    PaqueteCargado cargado;
+    integrarAtlas(atlas, &cargado);
+    paquetesCargados[paquete] = cargado;
 
-    // Vortice
-    cargarSprite("vortice", rutaNivel3 + "vortice/vortice.png");
+    qDebug() << "[GestorSprites] Paquete" << paquete << "cargado:"
+             << cargado.sprites.size() << "sprites en" << cargado.paginas.size() << "paginas";
 }
 
-void GestorSprites::cargarSpritesUI() {
-    qDebug() << "\n=== UI/MENU ===";
+bool GestorSprites::paqueteCargado(int paquete) const {
+    QMutexLocker bloqueo(&mutexAtlas);
+    return paquetesCargados.contains(paquete);
+}
 
-    QString rutaUI = rutaBase + "ui/";
+bool GestorSprites::paqueteEnCarga(int paquete) const {
+    if (cargasEnCurso.count(paquete) > 0) return true;
 
-    // Fondo de menu
-    cargarSprite("menu_fondo", rutaUI + "menu_fondo.jpg");
+    QMutexLocker bloqueo(&mutexAtlas);
+    return entregasPendientes.contains(paquete);
+}
+
+void GestorSprites::precargarPaquete(int paquete) {
+    if (paquete < 0 || paquete >= NUM_PAQUETES) return;
+    if (paqueteCargado(paquete) || paqueteEnCarga(paquete)) return;
+
+    if (archivoAssets->tienePaquete(paquete)) {
+        // El archivo compartido se destruye despues del gestor, y el
+        // destructor espera las cargas en curso
+        const ArchivoAssets* archivo = archivoAssets;
+        cargasEnCurso[paquete] = std::async(std::launch::async, [archivo, paquete]() {
+            return archivo->leerPaquete(paquete);
+        });
+    } else {
+        cargasEnCurso[paquete] = std::async(std::launch::async, &GestorSprites::decodificarPaquete,
+                                            archivosPaquete(paquete, rutaBase));
+    }
+}
+
+void GestorSprites::descargarPaquete(int paquete) {
+    // Una precarga a medio camino se descarta sin esperarla
+    auto enCurso = cargasEnCurso.find(paquete);
+    if (enCurso != cargasEnCurso.end()) {
+        cargasAbandonadas.push_back(std::move(enCurso->second));
+        cargasEnCurso.erase(enCurso);
+    }
+
+    QMutexLocker bloqueo(&mutexAtlas);
+
+    // Si esperaba a la GUI, la instalacion encolada ya no lo agrega
+    entregasPendientes.remove(paquete);
+
+    auto it = paquetesCargados.find(paquete);
+    if (it == paquetesCargados.end()) return;
+
+    // El id queda reservado: al recargar el paquete vuelve a ser el mismo
+    for (SpriteId id : it.value().sprites) {
+        regiones[id] = RegionSprite();
+    }
+
+    // Los indices de pagina de los demas paquetes no cambian; los de este
+    // quedan libres para la proxima carga
+    for (int pagina : it.value().paginas) {
+        paginas[pagina] = QPixmap();
+        paginasLibres.append(pagina);
+    }
+
+    paquetesCargados.erase(it);
+
+    // Las variantes escaladas pueden ser de este paquete
+    escalados.clear();
+
+    qDebug() << "[GestorSprites] Paquete" << paquete << "descargado";
+}
+
+void GestorSprites::prepararNivel(int nivel) {
+    // Se llama desde el tick: pedir, nunca esperar (tampoco si la
+    // simulacion corre en el hilo de la GUI)
+    precargarPaquete(PAQUETE_MENU);
+    precargarPaquete(nivel);
+
+    for (int paquete = 1; paquete < NUM_PAQUETES; paquete++) {
+        if (paquete != nivel && paquete != nivel + 1) {
+            descargarPaquete(paquete);
+        }
+    }
+
+    // El siguiente nivel se decodifica mientras se juega este
+    precargarPaquete(nivel + 1);
+
+    // Lo que ya estaba decodificado (la precarga del nivel anterior) se
+    // entrega ahora, sin esperar al proximo tick
+    procesarCargas();
+}
+
+void GestorSprites::procesarCargas() {
+    // Las descartadas que ya terminaron se sueltan sin bloquear
+    cargasAbandonadas.erase(
+        std::remove_if(cargasAbandonadas.begin(), cargasAbandonadas.end(),
+                       [](const std::future<AtlasTexturas>& carga) {
+                           return carga.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                       }),
+        cargasAbandonadas.end());
+
+    // Solo las terminadas: get() no espera. Las paginas se crean en la GUI
+    for (auto it = cargasEnCurso.begin(); it != cargasEnCurso.end();) {
+        if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            entregarPaquete(it->first, it->second.get());
+            it = cargasEnCurso.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// ========================================
+// CARGA DE TODOS LOS SPRITES
+// ========================================
+
+void GestorSprites::cargarTodosLosSprites() {
+    qDebug() << "\n========================================";
+    qDebug() << "INICIANDO CARGA DE SPRITES";
+    qDebug() << "========================================\n";
+
+    for (int paquete = 0; paquete < NUM_PAQUETES; paquete++) {
+        cargarPaquete(paquete);
+    }
+
+    qDebug() << "\n========================================";
+    qDebug() << "CARGA COMPLETADA";
+    qDebug() << "Total sprites:" << std::count_if(regiones.cbegin(), regiones.cend(),
+                                                  [](const RegionSprite& r) { return r.esValida(); });
+    qDebug() << "Total animaciones:" << animaciones.size();
+    qDebug() << "Paginas de atlas:" << paginas.size();
+    qDebug() << "========================================\n";
 }
@@ -1,17 +1,29 @@
 #ifndef GESTORSPRITES_H
 #define GESTORSPRITES_H
 
+#include "atlastexturas.h"
+#include "archivoassets.h"
 #include <QPixmap>
+#include <QPainter>
 #include <QMap>
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QRect>
 #include <QString>
 #include <QDebug>
 #include <QVector>
 #include <QDir>
 #include <QCoreApplication>
+#include <QRecursiveMutex>
+#include <QMutexLocker>
+#include <future>
+#include <map>
+#include <vector>
 
 // Estructura para animaciones
 struct Animacion {
-    QVector<QPixmap> frames;
+    QVector<SpriteId> frames;   // Frames en el atlas
     int frameActual;
     float tiempoFrame;      // Tiempo entre frames
     float tiempoAcumulado;
@@ -20,12 +32,83 @@ struct Animacion {
     Animacion() : frameActual(0), tiempoFrame(0.1f), tiempoAcumulado(0.0f), loop(true) {}
 };
 
+// Clave de una variante escalada: sprite (o zona de un sprite sheet),
+// tamaño destino, volteo horizontal y modo de aspecto
+struct ClaveSpriteEscalado {
+    SpriteId sprite;
+    QRect recorte;          // Nulo = sprite completo
+    int ancho;
+    int alto;
+    bool volteado;
+    int modo;               // Qt::AspectRatioMode
+
+    bool operator==(const ClaveSpriteEscalado& otra) const {
+        return sprite == otra.sprite && recorte == otra.recorte &&
+               ancho == otra.ancho && alto == otra.alto &&
+               volteado == otra.volteado && modo == otra.modo;
+    }
+};
+
+// Archivo de un sprite dentro de un paquete
+struct ArchivoSprite {
+    QString nombre;
+    QString ruta;
+};
+
+inline size_t qHash(const ClaveSpriteEscalado& clave, size_t semilla = 0) {
+    return qHashMulti(semilla, clave.sprite,
+                      clave.recorte.x(), clave.recorte.y(),
+                      clave.recorte.width(), clave.recorte.height(),
+                      clave.ancho, clave.alto, clave.volteado, clave.modo);
+}
+
 class GestorSprites {
 private:
     static GestorSprites* instancia;
-    QMap<QString, QPixmap> sprites;
     QMap<QString, Animacion> animaciones;
-    QString rutaBase;
+    QString rutaBase;               // Solo sin archivo de assets (carpeta suelta)
+    const ArchivoAssets* archivoAssets; // assets.lpk compartido con GestorSonidos
+
+    // Todos los sprites viven en unas pocas paginas de atlas; cada
+    // SpriteId indexa su region (pagina + rectangulo). Invalida = no cargado
+    QVector<RegionSprite> regiones;
+    QVector<QPixmap> paginas;       // Paginas del atlas listas para dibujar (nulas = descargadas)
+    QVector<int> paginasLibres;     // Indices descargados: las cargas nuevas los reusan
+    AtlasTexturas pendiente;        // Sprites sueltos acumulados hasta cerrarAtlas()
+    bool empaquetando;
+
+    // ===== PAQUETES (MENU + UNO POR NIVEL) =====
+    // Cada paquete se decodifica y empaqueta en su propio atlas, asi se
+    // puede cargar en otro hilo y descargar entero al cambiar de nivel
+    struct PaqueteCargado {
+        QVector<int> paginas;
+        QVector<SpriteId> sprites;
+    };
+    QMap<int, PaqueteCargado> paquetesCargados;
+    std::map<int, std::future<AtlasTexturas>> cargasEnCurso;     // std::future no se copia
+    // Precargas descartadas a medio camino. Destruir el future esperaria a
+    // que termine la decodificacion: se guardan y procesarCargas() las
+    // suelta cuando ya terminaron
+    std::vector<std::future<AtlasTexturas>> cargasAbandonadas;
+    // Decodificados que esperan su turno en el hilo de la GUI. Descargar
+    // un paquete lo saca de aqui y la instalacion encolada se descarta
+    QSet<int> entregasPendientes;
+
+    // Las paginas (QPixmap) se crean solo en el hilo de la GUI: desde
+    // otro hilo el atlas se encola y se instala alla
+    void entregarPaquete(int paquete, const AtlasTexturas& atlas);
+    void instalarPaquete(int paquete, AtlasTexturas atlas);
+    static bool enHiloGui();
+
+    // Variantes ya escaladas (LRU). El costo de cada una es su memoria en KB
+    QCache<ClaveSpriteEscalado, QPixmap> escalados;
+    static const int LIMITE_CACHE_MB = 64;
+
+    // Durante el juego los niveles dibujan (y cargan paquetes) en el hilo
+    // de simulacion mientras las pantallas de la GUI dibujan el menu:
+    // paginas, regiones y escalados se tocan con este mutex tomado.
+    // Recursivo: dibujarSprite pide la variante a getFrameEscalado
+    mutable QRecursiveMutex mutexAtlas;
 
     GestorSprites();
 
@@ -35,29 +118,107 @@ public:
 
     ~GestorSprites();
 
+    // ========== IDS DE SPRITE ==========
+    // Interna el nombre (una vez, al cargar o al construir la entidad) y
+    // devuelve su handle. No crea la instancia ni toca QPixmap: se puede
+    // llamar desde cualquier hilo, tambien antes de cargar el paquete
+    static SpriteId idSprite(const QString& nombre);
+    static QString nombreSprite(SpriteId id);
+
+    // O(1): acceso directo al arreglo, sin QString ni QMap por frame.
+    // Con el mutex: la GUI instala paquetes mientras la simulacion dibuja
+    RegionSprite getRegion(SpriteId id) const {
+        QMutexLocker bloqueo(&mutexAtlas);
+        return (id >= 0 && id < regiones.size()) ? regiones[id] : RegionSprite();
+    }
+    bool tieneSprite(SpriteId id) const { return getRegion(id).esValida(); }
+
     // Cargar sprites individuales
     bool cargarSprite(const QString& nombre, const QString& ruta);
+
+    // ===== POR NOMBRE (herramientas e inicializacion, no por frame) =====
+    // Copia del sprite fuera del atlas
     QPixmap getSprite(const QString& nombre);
-    bool tieneSprite(const QString& nombre);
+    bool tieneSprite(const QString& nombre) { return tieneSprite(idSprite(nombre)); }
+    RegionSprite getRegion(const QString& nombre) const { return getRegion(idSprite(nombre)); }
+
+    // ========== ATLAS ==========
+    const QPixmap& getPaginaAtlas(int pagina) const { return paginas[pagina]; }
+    int getNumPaginasAtlas() const { return paginas.size(); }
+
+    // Dibuja una region del atlas sobre 'destino' (sin copias)
+    void dibujarRegion(QPainter& painter, const QRectF& destino, const RegionSprite& region) const;
+
+    // Dibuja un sprite (o una zona de el, relativa al sprite) en (x, y)
+    // con tamaño ancho×alto. A tamaño natural va directo del atlas; si
+    // hay que escalar o voltear usa la variante del cache de escalados.
+    // Devuelve false si el sprite no existe (para dibujar un reemplazo)
+    bool dibujarSprite(QPainter& painter, float x, float y, SpriteId sprite,
+                       int ancho, int alto, bool volteado = false,
+                       Qt::AspectRatioMode modo = Qt::IgnoreAspectRatio,
+                       const QRect& recorte = QRect());
+
+    // ========== SPRITES ESCALADOS (CACHE) ==========
+    // Cada variante (tamaño, volteo, modo) se escala una sola vez; las
+    // siguientes llamadas devuelven la copia guardada. Pensado para
+    // llamarse en cada frame desde renderizar() sin volver a muestrear
+    QPixmap getSpriteEscalado(SpriteId sprite, int ancho, int alto, bool volteado = false,
+                              Qt::AspectRatioMode modo = Qt::IgnoreAspectRatio);
+    // Igual, pero de una zona del sprite (un frame de un sprite sheet)
+    QPixmap getFrameEscalado(SpriteId sprite, const QRect& recorte, int ancho, int alto,
+                             bool volteado = false, Qt::AspectRatioMode modo = Qt::IgnoreAspectRatio);
+
+    void setLimiteCacheEscalados(int megabytes);
+    int getMemoriaCacheEscalados() const;       // KB ocupados
+    void limpiarCacheEscalados();
 
     // Cargar animaciones (sprites secuenciales)
     bool cargarAnimacion(const QString& nombre, const QString& rutaCarpeta,
                          const QString& prefijo, int numFrames, float tiempoFrame = 0.1f);
-    QPixmap getFrameAnimacion(const QString& nombre, float dt);
+    RegionSprite getFrameAnimacion(const QString& nombre, float dt);
     void reiniciarAnimacion(const QString& nombre);
 
-    // Cargar todos los assets del juego
+    // ========== PAQUETES (CARGA POR NIVEL) ==========
+    // Paquete 0 = menu y pantallas; 1..3 = niveles. Los PNG/JPG se
+    // decodifican a QImage en un hilo de trabajo; la conversion a QPixmap
+    // y la instalacion de las paginas ocurren siempre en el hilo de la GUI
+    static const int PAQUETE_MENU = 0;
+    static const int NUM_PAQUETES = 4;
+
+    // Bloquea hasta tenerlo (espera la precarga si hay). Solo en el hilo
+    // de la GUI: arranque y herramientas; desde otro hilo solo la pide
+    void cargarPaquete(int paquete);
+    void precargarPaquete(int paquete);         // En segundo plano; no bloquea
+    void descargarPaquete(int paquete);
+    // Deja cargados solo el menu, el nivel actual y el siguiente
+    // (precargado). No bloquea: un paquete que todavia se decodifica se
+    // instala unos frames despues y mientras tanto se dibujan reemplazos
+    void prepararNivel(int nivel);
+    bool paqueteCargado(int paquete) const;
+    bool paqueteEnCarga(int paquete) const;     // Decodificando o esperando a la GUI
+    // Pasa a la GUI las precargas terminadas sin esperar ninguna (llamar
+    // en cada tick desde el hilo de simulacion)
+    void procesarCargas();
+
+    // Cargar todos los assets del juego (todos los paquetes, sincrono)
     void cargarTodosLosSprites();
     void setRutaBase(const QString& ruta);
 
     // Obtener ruta de assets (relativa al ejecutable)
     QString obtenerRutaAssets();
+    bool usaArchivoAssets() const { return archivoAssets->estaAbierto(); }
+
+    // ========== CARPETA SUELTA (empaquetador y desarrollo) ==========
+    static QVector<ArchivoSprite> archivosPaquete(int paquete, const QString& rutaSprites);
+    // Solo QImage: corre en cualquier hilo
+    static AtlasTexturas decodificarPaquete(QVector<ArchivoSprite> archivos);
 
 private:
-    void cargarSpritesNivel1();
-    void cargarSpritesNivel2();
-    void cargarSpritesNivel3();
-    void cargarSpritesUI();
+    void iniciarAtlas();
+    void cerrarAtlas();             // Empaqueta lo pendiente en paginas nuevas
+    // Convierte las paginas a QPixmap y registra las regiones
+    void integrarAtlas(AtlasTexturas& atlas, PaqueteCargado* paquete);
+    QRect resolverFuente(const RegionSprite& region, const QRect& recorte) const;
 };
 
 #endif // GESTORSPRITES_H
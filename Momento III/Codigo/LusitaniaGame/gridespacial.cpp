@@ -0,0 +1,150 @@
+#include "gridespacial.h"
+#include <algorithm>
+#include <cmath>
+
+// ========== CONSTRUCTOR ==========
+
+GridEspacial::GridEspacial()
+    : anchoMundo(0.0f),
+    altoMundo(0.0f),
+    tamanioCelda(128.0f),
+    columnas(1),
+    filas(1) {
+}
+
+// ========== CONFIGURACION ==========
+
+void GridEspacial::configurar(float ancho, float alto, float celda) {
+    anchoMundo = std::max(ancho, 1.0f);
+    altoMundo = std::max(alto, 1.0f);
+    tamanioCelda = std::max(celda, 1.0f);
+
+    columnas = std::max(1, static_cast<int>(std::ceil(anchoMundo / tamanioCelda)));
+    filas = std::max(1, static_cast<int>(std::ceil(altoMundo / tamanioCelda)));
+
+    inicioCelda.assign(columnas * filas + 1, 0);
+}
+
+// ========== HELPERS ==========
+
+int GridEspacial::columnaDe(float x) const {
+    // Las entidades fuera del mundo se agrupan en las celdas del borde
+    int col = static_cast<int>(std::floor(x / tamanioCelda));
+    return std::max(0, std::min(col, columnas - 1));
+}
+
+int GridEspacial::filaDe(float y) const {
+    int fila = static_cast<int>(std::floor(y / tamanioCelda));
+    return std::max(0, std::min(fila, filas - 1));
+}
+
+// ========== CONSTRUCCION ==========
+
+void GridEspacial::construir(const std::vector<Entidad*>& entidades) {
+    size_t numEntidades = entidades.size();
+    rangos.assign(numEntidades, RangoCeldas());
+
+    if (inicioCelda.size() != static_cast<size_t>(columnas * filas + 1)) {
+        inicioCelda.assign(columnas * filas + 1, 0);
+    } else {
+        std::fill(inicioCelda.begin(), inicioCelda.end(), 0);
+    }
+
+    // 1. Calcular el rango de celdas de cada entidad y contar por celda
+    int totalInserciones = 0;
+
+    for (size_t i = 0; i < numEntidades; i++) {
+        Entidad* e = entidades[i];
+        if (!e || !e->estaActivo()) continue;
+
+        CajaColision c = e->getColision();
+        RangoCeldas& r = rangos[i];
+        r.colMin = columnaDe(c.x);
+        r.colMax = columnaDe(c.x + c.ancho);
+        r.filaMin = filaDe(c.y);
+        r.filaMax = filaDe(c.y + c.alto);
+        r.valido = true;
+
+        for (int f = r.filaMin; f <= r.filaMax; f++) {
+            for (int col = r.colMin; col <= r.colMax; col++) {
+                inicioCelda[f * columnas + col + 1]++;
+            }
+        }
+
+        totalInserciones += (r.colMax - r.colMin + 1) * (r.filaMax - r.filaMin + 1);
+    }
+
+    // 2. Suma prefija: inicio de cada celda dentro de 'indices'
+    for (size_t c = 1; c < inicioCelda.size(); c++) {
+        inicioCelda[c] += inicioCelda[c - 1];
+    }
+
+    // 3. Colocar cada entidad en sus celdas (en orden creciente de indice)
+    indices.resize(totalInserciones);
+    cursor.assign(inicioCelda.begin(), inicioCelda.end() - 1);
+
+    for (size_t i = 0; i < numEntidades; i++) {
+        const RangoCeldas& r = rangos[i];
+        if (!r.valido) continue;
+
+        for (int f = r.filaMin; f <= r.filaMax; f++) {
+            for (int col = r.colMin; col <= r.colMax; col++) {
+                indices[cursor[f * columnas + col]++] = static_cast<int>(i);
+            }
+        }
+    }
+}
+
+// ========== CONSULTA ==========
+
+void GridEspacial::obtenerParesCandidatos(std::vector<std::pair<int, int>>& pares) const {
+    pares.clear();
+
+    int numCeldas = columnas * filas;
+
+    for (int celda = 0; celda < numCeldas; celda++) {
+        int inicio = inicioCelda[celda];
+        int fin = inicioCelda[celda + 1];
+        if (fin - inicio < 2) continue;
+
+        int col = celda % columnas;
+        int fila = celda / columnas;
+
+        for (int a = inicio; a < fin; a++) {
+            int i = indices[a];
+            const RangoCeldas& ra = rangos[i];
+
+            for (int b = a + 1; b < fin; b++) {
+                int j = indices[b];
+                const RangoCeldas& rb = rangos[j];
+
+                // Un par puede compartir varias celdas: solo se reporta
+                // en la primera celda comun (esquina superior izquierda
+                // de la interseccion de ambos rangos)
+                int colComun = std::max(ra.colMin, rb.colMin);
+                int filaComun = std::max(ra.filaMin, rb.filaMin);
+
+                if (colComun == col && filaComun == fila) {
+                    pares.emplace_back(i, j);
+                }
+            }
+        }
+    }
+
+    // Mismo orden que el doble ciclo de fuerza bruta
+    std::sort(pares.begin(), pares.end());
+}
+
+// ========== GETTERS ==========
+
+float GridEspacial::getTamanioCelda() const {
+    return tamanioCelda;
+}
+
+int GridEspacial::getColumnas() const {
+    return columnas;
+}
+
+int GridEspacial::getFilas() const {
+    return filas;
+}
@@ -0,0 +1,64 @@
+#ifndef GRIDESPACIAL_H
+#define GRIDESPACIAL_H
+
+#include "entidad.h"
+#include <vector>
+#include <utility>
+
+// Grid uniforme para la fase amplia (broadphase) de colisiones
+// Divide el mundo en celdas de tamanio fijo y agrupa las entidades
+// por celda, de modo que solo se prueban pares que comparten celda.
+// El costo depende de la densidad local, no del cuadrado de entidades.
+class GridEspacial {
+private:
+    // Rango de celdas que cubre la caja de una entidad (inclusivo)
+    struct RangoCeldas {
+        int colMin, colMax;
+        int filaMin, filaMax;
+        bool valido;
+
+        RangoCeldas() : colMin(0), colMax(-1), filaMin(0), filaMax(-1), valido(false) {}
+    };
+
+    float anchoMundo;
+    float altoMundo;
+    float tamanioCelda;
+    int columnas;
+    int filas;
+
+    // Ordenamiento por conteo: las entidades de la celda c estan en
+    // indices[inicioCelda[c] .. inicioCelda[c+1])
+    std::vector<int> inicioCelda;
+    std::vector<int> indices;
+    std::vector<int> cursor;         // Posicion de escritura por celda (reutilizado)
+    std::vector<RangoCeldas> rangos;
+
+    // Helpers
+    int columnaDe(float x) const;
+    int filaDe(float y) const;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    GridEspacial();
+
+    // ========== CONFIGURACION ==========
+    // Dimensiona el grid segun el tamanio del nivel
+    void configurar(float ancho, float alto, float celda);
+
+    // ========== CONSTRUCCION ==========
+    // Reparte las entidades activas en las celdas (se llama cada frame)
+    void construir(const std::vector<Entidad*>& entidades);
+
+    // ========== CONSULTA ==========
+    // Pares (i, j) con i < j de entidades que comparten al menos una celda.
+    // Cada par aparece una sola vez y en el mismo orden que el recorrido
+    // por fuerza bruta (ordenado por i y luego por j).
+    void obtenerParesCandidatos(std::vector<std::pair<int, int>>& pares) const;
+
+    // ========== GETTERS ==========
+    float getTamanioCelda() const;
+    int getColumnas() const;
+    int getFilas() const;
+};
+
+#endif // GRIDESPACIAL_H
@@ -0,0 +1,16 @@
+# Simulador sin ventana: corre niveles a paso fijo tan rapido como
+# permita la CPU, con entrada por guion o aleatoria.
+# Uso: lusitania_headless --nivel 3 --episodios 1000 --entrada aleatoria
+
+QT       += core gui
+QT       -= widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = lusitania_headless
+
+include(../nucleo.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,191 @@
+#include "simuladorheadless.h"
+#include "ejecutorparalelo.h"
+#include "gestorsprites.h"
+#include "nivel3submarino.h"
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QLoggingCategory>
+#include <QTextStream>
+#include <cstdio>
+
+// ========== LUSITANIA HEADLESS ==========
+// Corre episodios de un nivel sin ventana ni render, repartidos entre
+// varios hilos, y reporta episodios por segundo y las puntuaciones
+// finales. Con --csv escribe una fila por episodio.
+
+int main(int argc, char *argv[]) {
+    // QPixmap necesita una QGuiApplication: usar la plataforma offscreen
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("lusitania_headless");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulador sin ventana de El Naufragio del Lusitania");
+    parser.addHelpOption();
+
+    QCommandLineOption opcionNivel("nivel", "Nivel a simular (1, 2, 3; 0 = todos).", "n", "0");
+    QCommandLineOption opcionEpisodios("episodios", "Episodios por nivel.", "n", "10");
+    QCommandLineOption opcionFrecuencia("frecuencia", "Pasos de simulacion por segundo.", "hz", "60");
+    QCommandLineOption opcionDuracion("duracion", "Segundos simulados maximos por episodio (0 = limite del nivel).", "s", "0");
+    QCommandLineOption opcionEntrada("entrada", "Entrada del jugador: ninguna, aleatoria o guion.", "modo", "aleatoria");
+    QCommandLineOption opcionGuion("guion", "Archivo de guion (lineas 'desde hasta TECLAS').", "archivo");
+    QCommandLineOption opcionSemilla("semilla", "Semilla base: cada episodio deriva la suya (niveles y entrada).", "n", "1");
+    QCommandLineOption opcionDetalle("detalle", "Imprimir cada episodio.");
+    QCommandLineOption opcionHilos("hilos", "Hilos de simulacion (0 = uno por nucleo).", "n", "0");
+    QCommandLineOption opcionCSV("csv", "Archivo CSV con una fila por episodio ('-' = salida estandar).", "archivo");
+    QCommandLineOption opcionVortices("vortices", "Atraccion de vortices sobre escombros (nivel 3): campo o exacta.", "modo", "exacta");
+
+    parser.addOption(opcionNivel);
+    parser.addOption(opcionEpisodios);
+    parser.addOption(opcionFrecuencia);
+    parser.addOption(opcionDuracion);
+    parser.addOption(opcionEntrada);
+    parser.addOption(opcionGuion);
+    parser.addOption(opcionSemilla);
+    parser.addOption(opcionDetalle);
+    parser.addOption(opcionHilos);
+    parser.addOption(opcionCSV);
+    parser.addOption(opcionVortices);
+    parser.process(app);
+
+    // Silenciar los qDebug del juego (sprites no cargados, etc.)
+    QLoggingCategory::setFilterRules("default.debug=false");
+
+    QTextStream salida(stdout);
+
+    // ===== CONFIGURACION =====
+    int nivelPedido = parser.value(opcionNivel).toInt();
+    int episodios = qMax(1, parser.value(opcionEpisodios).toInt());
+    int frecuencia = qMax(1, parser.value(opcionFrecuencia).toInt());
+    float duracion = parser.value(opcionDuracion).toFloat();
+    uint64_t semilla = parser.value(opcionSemilla).toULongLong();
+    bool detalle = parser.isSet(opcionDetalle);
+    int hilos = qMax(0, parser.value(opcionHilos).toInt());
+
+    ModoEntrada modo = ModoEntrada::ALEATORIA;
+    QString nombreModo = parser.value(opcionEntrada).toLower();
+    if (nombreModo == "ninguna") {
+        modo = ModoEntrada::NINGUNA;
+    } else if (nombreModo == "guion") {
+        modo = ModoEntrada::GUION;
+    } else if (nombreModo != "aleatoria") {
+        salida << "Modo de entrada desconocido: " << nombreModo << Qt::endl;
+        return 1;
+    }
+
+    QString nombreVortices = parser.value(opcionVortices).toLower();
+    if (nombreVortices == "campo" || nombreVortices == "exacta") {
+        Nivel3Submarino::setCampoVorticesPorDefecto(nombreVortices == "campo");
+    } else {
+        salida << "Modo de vortices desconocido: " << nombreVortices << Qt::endl;
+        return 1;
+    }
+
+    std::vector<int> niveles;
+    if (nivelPedido == 0) {
+        niveles = {1, 2, 3};
+    } else if (nivelPedido >= 1 && nivelPedido <= 3) {
+        niveles = {nivelPedido};
+    } else {
+        salida << "Nivel invalido: " << nivelPedido << Qt::endl;
+        return 1;
+    }
+
+    // ===== EJECUCION =====
+    EjecutorParalelo ejecutor(hilos);
+
+    for (int numeroNivel : niveles) {
+        SimuladorHeadless simulador(numeroNivel);
+        simulador.setFrecuenciaSimulacion(frecuencia);
+        simulador.setDuracionMaxima(duracion);
+        simulador.setModoEntrada(modo);
+        simulador.setSemilla(semilla);
+
+        if (modo == ModoEntrada::GUION) {
+            if (!parser.isSet(opcionGuion) || !simulador.cargarGuion(parser.value(opcionGuion))) {
+                salida << "El modo guion necesita --guion <archivo> valido" << Qt::endl;
+                return 1;
+            }
+        }
+
+        ejecutor.agregarLote(simulador, episodios);
+    }
+
+    std::vector<ResultadoEpisodio> resultados = ejecutor.ejecutar();
+
+    // ===== RESUMEN POR NIVEL =====
+    // Con --csv - la salida estandar es solo el CSV
+    bool csvEnSalida = parser.isSet(opcionCSV) && parser.value(opcionCSV) == "-";
+
+    for (int numeroNivel : niveles) {
+        int cantidad = 0;
+        int victorias = 0;
+        int derrotas = 0;
+        long long sumaPuntos = 0;
+        int mejorPuntuacion = 0;
+        int peorPuntuacion = 0;
+        double tiempoSimulado = 0.0;
+        double tiempoReal = 0.0;
+        long long pasos = 0;
+
+        for (const auto& r : resultados) {
+            if (r.nivel != numeroNivel) continue;
+
+            if (r.completado) victorias++;
+            if (r.fallado) derrotas++;
+            sumaPuntos += r.puntuacion;
+            mejorPuntuacion = (cantidad == 0) ? r.puntuacion : qMax(mejorPuntuacion, r.puntuacion);
+            peorPuntuacion = (cantidad == 0) ? r.puntuacion : qMin(peorPuntuacion, r.puntuacion);
+            tiempoSimulado += r.tiempoSimulado;
+            tiempoReal += r.tiempoReal;
+            pasos += r.pasos;
+            cantidad++;
+
+            if (detalle && !csvEnSalida) {
+                salida << "nivel " << r.nivel << " episodio " << r.episodio
+                       << " semilla " << (qulonglong)r.semilla
+                       << ": puntos=" << r.puntuacion
+                       << " resultado=" << (r.completado ? "victoria" : (r.fallado ? "derrota" : "tiempo"))
+                       << " simulado=" << r.tiempoSimulado << "s"
+                       << " real=" << r.tiempoReal * 1000.0 << "ms" << Qt::endl;
+            }
+        }
+
+        if (cantidad == 0 || csvEnSalida) continue;
+
+        // Velocidad de un hilo: tiempo simulado sobre el tiempo de CPU de sus episodios
+        double velocidad = (tiempoReal > 0.0) ? tiempoSimulado / tiempoReal : 0.0;
+
+        salida << "===== Nivel " << numeroNivel << " =====" << Qt::endl;
+        salida << "  episodios:          " << cantidad << Qt::endl;
+        salida << "  victorias/derrotas: " << victorias << " / " << derrotas << Qt::endl;
+        salida << "  puntuacion:         media " << (double)sumaPuntos / cantidad
+               << ", min " << peorPuntuacion << ", max " << mejorPuntuacion << Qt::endl;
+        salida << "  pasos:              " << pasos << Qt::endl;
+        salida << "  tiempo simulado:    " << tiempoSimulado << " s" << Qt::endl;
+        salida << "  tiempo en hilos:    " << tiempoReal << " s" << Qt::endl;
+        salida << "  velocidad por hilo: " << velocidad << " s simulados / s real" << Qt::endl;
+    }
+
+    if (parser.isSet(opcionCSV)) {
+        if (!EjecutorParalelo::escribirCSV(resultados, parser.value(opcionCSV))) {
+            return 1;
+        }
+    }
+
+    if (!csvEnSalida) {
+        double total = ejecutor.getTiempoReal();
+        double episodiosPorSegundo = (total > 0.0) ? resultados.size() / total : 0.0;
+
+        salida << "Hilos: " << ejecutor.getNumeroHilos() << Qt::endl;
+        salida << "Total: " << resultados.size() << " episodios en " << total << " s ("
+               << episodiosPorSegundo << " episodios/s)" << Qt::endl;
+    }
+
+    GestorSprites::destruirInstancia();
+    ArchivoAssets::destruirCompartido();
+    return 0;
+}
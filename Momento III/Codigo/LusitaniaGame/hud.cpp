@@ -3,9 +3,29 @@
 #include "nivel2barco.h"
 #include "nivel3submarino.h"
 #include <QFont>
+#include <algorithm>
 
 // ========== CONSTRUCTOR ==========
 
+DatosHUD::DatosHUD()
+    : valido(false),
+    tipo(GENERAL),
+    numeroNivel(0),
+    puntuacion(0),
+    tiempoTranscurrido(0.0f),
+    tiempoLimite(0.0f),
+    hayJugador(false),
+    salud(0.0f),
+    saludMaxima(1.0f),
+    oxigeno(0.0f),
+    oxigenoMaximo(1.0f),
+    posicionY(0.0f),
+    anguloBarco(0.0f),
+    rescatados(0),
+    objetivoRescate(0),
+    muertos(0) {
+}
+
 HUD::HUD()
     : colorFondo(QColor(0, 0, 0, 180)),
     colorTexto(QColor(255, 255, 255)),
@@ -17,42 +37,97 @@ HUD::HUD()
 HUD::~HUD() {
 }
 
-// ========== RENDERIZADO PRINCIPAL ==========
+// ========== CAPTURA (HILO DE SIMULACION) ==========
 
-void HUD::renderizar(QPainter& painter, Nivel* nivel, int fps) {
-    if (!nivel) return;
+DatosHUD HUD::capturar(Nivel* nivel) {
+    DatosHUD datos;
+    if (!nivel) return datos;
 
-    painter.save();
+    datos.valido = true;
+    datos.numeroNivel = MotorJuego::obtenerInstancia()->getNumeroNivelActual();
+    datos.puntuacion = nivel->getPuntuacion();
+    datos.tiempoTranscurrido = nivel->getTiempoTranscurrido();
+    datos.tiempoLimite = nivel->getTiempoLimite();
 
     Jugador* jugador = nivel->getJugador();
-
     if (jugador) {
-        renderizarBarraVida(painter, jugador, 10, 10);
+        datos.hayJugador = true;
+        datos.salud = jugador->getSalud();
+        datos.saludMaxima = jugador->getSaludMaxima();
+        datos.oxigeno = jugador->getOxigeno();
+        datos.oxigenoMaximo = jugador->getOxigenoMaximo();
+        datos.posicionY = jugador->getPosicion().y;
     }
 
-    if (nivel->getTiempoLimite() > 0.0f) {
-        renderizarBarraTiempo(painter, nivel, 540, 10);
+    if (Nivel2Barco* nivel2 = dynamic_cast<Nivel2Barco*>(nivel)) {
+        datos.tipo = DatosHUD::BARCO;
+        datos.anguloBarco = nivel2->getAnguloBarco();
+        datos.rescatados = nivel2->getNPCsRescatados();
+        datos.objetivoRescate = nivel2->getObjetivoNPCs();
+        datos.muertos = nivel2->getNPCsMuertos();
+    } else if (dynamic_cast<Nivel3Submarino*>(nivel)) {
+        datos.tipo = DatosHUD::SUBMARINO;
     }
 
-    // ===== INFORMACION ESPECIFICA POR NIVEL =====
-    Nivel2Barco* nivel2 = dynamic_cast<Nivel2Barco*>(nivel);
-    Nivel3Submarino* nivel3 = dynamic_cast<Nivel3Submarino*>(nivel);
+    return datos;
+}
 
-    if (nivel2) {
-        renderizarInfoNivel2(painter, nivel2, fps);
-    } else if (nivel3) {
-        renderizarInfoNivel3(painter, nivel3, jugador, fps);
+// ========== RENDERIZADO PRINCIPAL ==========
+
+void HUD::renderizar(QPainter& painter, const DatosHUD& datos, int fps) {
+    if (!datos.valido) return;
+
+    painter.save();
+
+    if (datos.hayJugador) {
+        renderizarBarraVida(painter, datos, 10, 10);
+    }
+
+    if (datos.tiempoLimite > 0.0f) {
+        renderizarBarraTiempo(painter, datos, 540, 10);
+    }
+
+    // ===== INFORMACION ESPECIFICA POR NIVEL =====
+    if (datos.tipo == DatosHUD::BARCO) {
+        renderizarInfoNivel2(painter, datos, fps);
+    } else if (datos.tipo == DatosHUD::SUBMARINO) {
+        renderizarInfoNivel3(painter, datos, fps);
     } else {
-        renderizarInformacion(painter, nivel, fps);
+        renderizarInformacion(painter, datos, fps);
     }
 
     painter.restore();
 }
 
+QRegion HUD::getRegion(const DatosHUD& datos) const {
+    QRegion region;
+    if (!datos.valido) return region;
+
+    // Mismos rectangulos que los drawRoundedRect, con el borde de 2 px
+    if (datos.hayJugador) {
+        region += QRect(10, 10, 300, 80).adjusted(-2, -2, 2, 2);
+    }
+
+    if (datos.tiempoLimite > 0.0f) {
+        region += QRect(540, 10, 250, 80).adjusted(-2, -2, 2, 2);
+    }
+
+    if (datos.tipo == DatosHUD::BARCO) {
+        region += QRect(10, 465, 260, 125).adjusted(-2, -2, 2, 2);
+    } else if (datos.tipo == DatosHUD::SUBMARINO) {
+        region += QRect(540, 100, 250, 80).adjusted(-2, -2, 2, 2);
+        region += QRect(10, 510, 230, 80).adjusted(-2, -2, 2, 2);
+    } else {
+        region += QRect(10, 510, 230, 80).adjusted(-2, -2, 2, 2);
+    }
+
+    return region;
+}
+
 // ========== METODOS DE RENDERIZADO ==========
 
-void HUD::renderizarBarraVida(QPainter& painter, Jugador* jugador, int x, int y) {
-    if (!jugador) return;
+void HUD::renderizarBarraVida(QPainter& painter, const DatosHUD& datos, int x, int y) {
+    if (!datos.hayJugador) return;
 
     painter.setBrush(colorFondo);
     painter.setPen(QPen(Qt::white, 2));
@@ -65,7 +140,7 @@ void HUD::renderizarBarraVida(QPainter& painter, Jugador* jugador, int x, int y)
     int anchoBarraMax = 280;
     int altoBarraVida = 25;
 
-    float porcentajeVida = jugador->getSalud() / jugador->getSaludMaxima();
+    float porcentajeVida = datos.salud / datos.saludMaxima;
     int anchoBarraVida = (int)(anchoBarraMax * porcentajeVida);
 
     QColor colorVida;
@@ -88,12 +163,12 @@ void HUD::renderizarBarraVida(QPainter& painter, Jugador* jugador, int x, int y)
     painter.setFont(QFont("Arial", 10, QFont::Bold));
     painter.drawText(x + 10, y + 70,
                      QString("%1 / %2")
-                         .arg((int)jugador->getSalud())
-                         .arg((int)jugador->getSaludMaxima()));
+                         .arg((int)datos.salud)
+                         .arg((int)datos.saludMaxima));
 }
 
-void HUD::renderizarBarraTiempo(QPainter& painter, Nivel* nivel, int x, int y) {
-    if (!nivel) return;
+void HUD::renderizarBarraTiempo(QPainter& painter, const DatosHUD& datos, int x, int y) {
+    if (datos.tiempoLimite <= 0.0f) return;
 
     painter.setBrush(colorFondo);
     painter.setPen(QPen(Qt::white, 2));
@@ -103,10 +178,10 @@ void HUD::renderizarBarraTiempo(QPainter& painter, Nivel* nivel, int x, int y) {
     painter.setPen(Qt::white);
     painter.drawText(x + 10, y + 20, "TIEMPO");
 
-    float tiempoRestante = nivel->getTiempoLimite() - nivel->getTiempoTranscurrido();
+    float tiempoRestante = datos.tiempoLimite - datos.tiempoTranscurrido;
     if (tiempoRestante < 0.0f) tiempoRestante = 0.0f;
 
-    float porcentajeTiempo = tiempoRestante / nivel->getTiempoLimite();
+    float porcentajeTiempo = tiempoRestante / datos.tiempoLimite;
 
     int anchoBarraMax = 230;
     int altoBarraTiempo = 25;
@@ -138,30 +213,26 @@ void HUD::renderizarBarraTiempo(QPainter& painter, Nivel* nivel, int x, int y) {
                          .arg(segundos, 2, 10, QChar('0')));
 }
 
-void HUD::renderizarInformacion(QPainter& painter, Nivel* nivel, int fps) {
-    if (!nivel) return;
-
+void HUD::renderizarInformacion(QPainter& painter, const DatosHUD& datos, int fps) {
     painter.setBrush(colorFondo);
     painter.setPen(QPen(Qt::white, 2));
     painter.drawRoundedRect(10, 510, 230, 80, 5, 5);
 
     painter.setFont(QFont("Arial", 11, QFont::Bold));
     painter.setPen(Qt::white);
-    painter.drawText(20, 530, QString("Puntuacion: %1").arg(nivel->getPuntuacion()));
-    painter.drawText(20, 548, QString("Nivel: %1").arg(MotorJuego::obtenerInstancia()->getNumeroNivelActual()));
+    painter.drawText(20, 530, QString("Puntuacion: %1").arg(datos.puntuacion));
+    painter.drawText(20, 548, QString("Nivel: %1").arg(datos.numeroNivel));
     painter.drawText(20, 566, QString("FPS: %1").arg(fps));
 
-    int minutos = (int)nivel->getTiempoTranscurrido() / 60;
-    int segundos = (int)nivel->getTiempoTranscurrido() % 60;
+    int minutos = (int)datos.tiempoTranscurrido / 60;
+    int segundos = (int)datos.tiempoTranscurrido % 60;
     painter.drawText(20, 584, QString("Tiempo: %1:%2")
                                   .arg(minutos, 2, 10, QChar('0'))
                                   .arg(segundos, 2, 10, QChar('0')));
 }
 
 // ===== RENDERIZADO ESPECIFICO PARA NIVEL 2 =====
-void HUD::renderizarInfoNivel2(QPainter& painter, Nivel2Barco* nivel2, int fps) {
-    if (!nivel2) return;
-
+void HUD::renderizarInfoNivel2(QPainter& painter, const DatosHUD& datos, int fps) {
     painter.setBrush(colorFondo);
     painter.setPen(QPen(Qt::white, 2));
     painter.drawRoundedRect(10, 465, 260, 125, 5, 5);
@@ -169,12 +240,12 @@ void HUD::renderizarInfoNivel2(QPainter& painter, Nivel2Barco* nivel2, int fps)
     painter.setFont(QFont("Arial", 11, QFont::Bold));
     painter.setPen(Qt::white);
 
-    painter.drawText(20, 485, QString("Puntuacion: %1").arg(nivel2->getPuntuacion()));
-    painter.drawText(20, 503, QString("Nivel: %1").arg(MotorJuego::obtenerInstancia()->getNumeroNivelActual()));
+    painter.drawText(20, 485, QString("Puntuacion: %1").arg(datos.puntuacion));
+    painter.drawText(20, 503, QString("Nivel: %1").arg(datos.numeroNivel));
     painter.drawText(20, 521, QString("FPS: %1").arg(fps));
 
     // Angulo de inclinacion
-    float angulo = nivel2->getAnguloBarco();
+    float angulo = datos.anguloBarco;
     QColor colorAngulo;
     if (angulo < 15.0f) colorAngulo = QColor(0, 255, 0);
     else if (angulo < 25.0f) colorAngulo = QColor(255, 165, 0);
@@ -185,26 +256,26 @@ void HUD::renderizarInfoNivel2(QPainter& painter, Nivel2Barco* nivel2, int fps)
 
     // Rescatados
     painter.setPen(Qt::white);
-    int rescatados = nivel2->getNPCsRescatados();
-    int objetivo = nivel2->getObjetivoNPCs();
+    int rescatados = datos.rescatados;
+    int objetivo = datos.objetivoRescate;
     painter.drawText(20, 557, QString("Rescatados: %1/%2").arg(rescatados).arg(objetivo));
 
     // ===== MUERTOS =====
-    int muertos = nivel2->getNPCsMuertos();
+    int muertos = datos.muertos;
     painter.setPen(QColor(255, 100, 100));
     painter.drawText(20, 575, QString("Muertos: %1").arg(muertos));
 
     painter.setPen(Qt::white);
-    int minutos = (int)nivel2->getTiempoTranscurrido() / 60;
-    int segundos = (int)nivel2->getTiempoTranscurrido() % 60;
+    int minutos = (int)datos.tiempoTranscurrido / 60;
+    int segundos = (int)datos.tiempoTranscurrido % 60;
     painter.drawText(20, 586, QString("Tiempo: %1:%2")
                                   .arg(minutos, 2, 10, QChar('0'))
                                   .arg(segundos, 2, 10, QChar('0')));
 }
 
 // ===== RENDERIZADO ESPECIFICO PARA NIVEL 3 =====
-void HUD::renderizarInfoNivel3(QPainter& painter, Nivel3Submarino* nivel3, Jugador* jugador, int fps) {
-    if (!nivel3 || !jugador) return;
+void HUD::renderizarInfoNivel3(QPainter& painter, const DatosHUD& datos, int fps) {
+    if (!datos.hayJugador) return;
 
     // ===== BARRA DE OXIGENO (ARRIBA A LA DERECHA) =====
     painter.setBrush(colorFondo);
@@ -218,7 +289,7 @@ void HUD::renderizarInfoNivel3(QPainter& painter, Nivel3Submarino* nivel3, Jugad
     int anchoBarraMax = 230;
     int altoBarraOxigeno = 25;
 
-    float porcentajeOxigeno = jugador->getOxigeno() / jugador->getOxigenoMaximo();
+    float porcentajeOxigeno = datos.oxigeno / datos.oxigenoMaximo;
     int anchoBarraOxigeno = (int)(anchoBarraMax * porcentajeOxigeno);
 
     QColor colorOxigeno;
@@ -241,8 +312,8 @@ void HUD::renderizarInfoNivel3(QPainter& painter, Nivel3Submarino* nivel3, Jugad
     painter.setFont(QFont("Arial", 10, QFont::Bold));
     painter.drawText(550, 170,
                      QString("%1 / %2")
-                         .arg((int)jugador->getOxigeno())
-                         .arg((int)jugador->getOxigenoMaximo()));
+                         .arg((int)datos.oxigeno)
+                         .arg((int)datos.oxigenoMaximo));
 
     // ===== INFORMACION GENERAL =====
     painter.setBrush(colorFondo);
@@ -251,17 +322,98 @@ void HUD::renderizarInfoNivel3(QPainter& painter, Nivel3Submarino* nivel3, Jugad
 
     painter.setFont(QFont("Arial", 11, QFont::Bold));
     painter.setPen(Qt::white);
-    painter.drawText(20, 530, QString("Puntuacion: %1").arg(nivel3->getPuntuacion()));
-    painter.drawText(20, 548, QString("Profundidad: %1m").arg((int)(3000 - jugador->getPosicion().y)));
+    painter.drawText(20, 530, QString("Puntuacion: %1").arg(datos.puntuacion));
+    painter.drawText(20, 548, QString("Profundidad: %1m").arg((int)(3000 - datos.posicionY)));
     painter.drawText(20, 566, QString("FPS: %1").arg(fps));
 
-    int minutos = (int)nivel3->getTiempoTranscurrido() / 60;
-    int segundos = (int)nivel3->getTiempoTranscurrido() % 60;
+    int minutos = (int)datos.tiempoTranscurrido / 60;
+    int segundos = (int)datos.tiempoTranscurrido % 60;
     painter.drawText(20, 584, QString("Tiempo: %1:%2")
                                   .arg(minutos, 2, 10, QChar('0'))
                                   .arg(segundos, 2, 10, QChar('0')));
 }
 
+// ===== OVERLAY DEL PERFILADOR (F3) =====
+void HUD::renderizarPerfilador(QPainter& painter, const Perfilador& perfilador) {
+    const int x = 10;
+    const int y = 100;
+    const int ancho = 330;
+    const int altoFila = 14;
+    const int altoGrafica = 60;
+    const float presupuestoMs = 1000.0f / 60.0f;    // 16.7 ms por frame
+    const float escalaMs = 50.0f;                   // Alto completo de la grafica
+
+    int filas = Perfilador::NUM_SECCIONES;
+    int alto = 24 + filas * altoFila + altoGrafica + 16;
+
+    painter.save();
+
+    painter.setBrush(colorFondo);
+    painter.setPen(QPen(Qt::white, 2));
+    painter.drawRoundedRect(x, y, ancho, alto, 5, 5);
+
+    // ===== TABLA =====
+    painter.setFont(QFont("Courier New", 9, QFont::Bold));
+    painter.setPen(Qt::white);
+    painter.drawText(x + 10, y + 16, QString("%1%2%3%4")
+                                         .arg("PERFIL (ms)", -16)
+                                         .arg("min", 7)
+                                         .arg("prom", 7)
+                                         .arg("p99", 7));
+
+    int fila = y + 16 + altoFila;
+    for (int s = 0; s < filas; s++) {
+        SeccionPerfil seccion = static_cast<SeccionPerfil>(s);
+        EstadisticasSeccion e = perfilador.getEstadisticas(seccion);
+
+        // El frame completo en rojo si el p99 no cabe en el presupuesto
+        if (seccion == SeccionPerfil::FRAME) {
+            painter.setPen(e.p99 > presupuestoMs ? colorVidaBaja : colorVidaAlta);
+        } else {
+            painter.setPen(Qt::white);
+        }
+
+        painter.drawText(x + 10, fila, QString("%1%2%3%4")
+                                           .arg(Perfilador::getNombre(seccion), -16)
+                                           .arg(e.minimo, 7, 'f', 2)
+                                           .arg(e.promedio, 7, 'f', 2)
+                                           .arg(e.p99, 7, 'f', 2));
+        fila += altoFila;
+    }
+
+    // ===== GRAFICA DE TIEMPO POR FRAME =====
+    int gx = x + 10;
+    int gy = fila;
+    int gw = ancho - 20;
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 120));
+    painter.drawRect(gx, gy, gw, altoGrafica);
+
+    int frames = perfilador.getFramesGuardados();
+    float anchoBarra = static_cast<float>(gw) / Perfilador::FRAMES_HISTORIAL;
+
+    // El frame mas reciente a la derecha
+    for (int atras = 0; atras < frames; atras++) {
+        float ms = perfilador.getMuestra(SeccionPerfil::FRAME, atras);
+        float altoBarra = std::min(ms / escalaMs, 1.0f) * altoGrafica;
+
+        QColor color = colorVidaAlta;
+        if (ms > 2.0f * presupuestoMs) color = colorVidaBaja;
+        else if (ms > presupuestoMs) color = colorVidaMedia;
+
+        float bx = gx + gw - (atras + 1) * anchoBarra;
+        painter.fillRect(QRectF(bx, gy + altoGrafica - altoBarra, anchoBarra, altoBarra), color);
+    }
+
+    // Linea del presupuesto (16.7 ms)
+    int yPresupuesto = gy + altoGrafica - static_cast<int>(presupuestoMs / escalaMs * altoGrafica);
+    painter.setPen(QPen(Qt::white, 1, Qt::DashLine));
+    painter.drawLine(gx, yPresupuesto, gx + gw, yPresupuesto);
+
+    painter.restore();
+}
+
 // ========== CONFIGURACION =====
 
 void HUD::setColorTexto(const QColor& color) {
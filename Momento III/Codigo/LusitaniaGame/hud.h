@@ -5,7 +5,42 @@
 #include "jugador.h"
 #include "nivel2barco.h"
 #include "nivel3submarino.h"
+#include "perfilador.h"
 #include <QPainter>
+#include <QRegion>
+
+// Valores que muestra el HUD, copiados del nivel en el hilo de
+// simulacion (HUD::capturar): la GUI los dibuja sin tocar el nivel
+struct DatosHUD {
+    enum Tipo {
+        GENERAL,
+        BARCO,          // Nivel 2: inclinacion y rescates
+        SUBMARINO       // Nivel 3: oxigeno y profundidad
+    };
+
+    bool valido;        // false = no hay nivel
+    Tipo tipo;
+    int numeroNivel;
+    int puntuacion;
+    float tiempoTranscurrido;
+    float tiempoLimite;
+
+    // ===== JUGADOR =====
+    bool hayJugador;
+    float salud;
+    float saludMaxima;
+    float oxigeno;
+    float oxigenoMaximo;
+    float posicionY;
+
+    // ===== NIVEL 2 =====
+    float anguloBarco;
+    int rescatados;
+    int objetivoRescate;
+    int muertos;
+
+    DatosHUD();
+};
 
 class HUD {
 private:
@@ -15,17 +50,27 @@ private:
     QColor colorVidaMedia;
     QColor colorVidaBaja;
 
-    void renderizarBarraVida(QPainter& painter, Jugador* jugador, int x, int y);
-    void renderizarBarraTiempo(QPainter& painter, Nivel* nivel, int x, int y);
-    void renderizarInformacion(QPainter& painter, Nivel* nivel, int fps);
-    void renderizarInfoNivel2(QPainter& painter, Nivel2Barco* nivel2, int fps);
-    void renderizarInfoNivel3(QPainter& painter, Nivel3Submarino* nivel3, Jugador* jugador, int fps);
+    void renderizarBarraVida(QPainter& painter, const DatosHUD& datos, int x, int y);
+    void renderizarBarraTiempo(QPainter& painter, const DatosHUD& datos, int x, int y);
+    void renderizarInformacion(QPainter& painter, const DatosHUD& datos, int fps);
+    void renderizarInfoNivel2(QPainter& painter, const DatosHUD& datos, int fps);
+    void renderizarInfoNivel3(QPainter& painter, const DatosHUD& datos, int fps);
 
 public:
     HUD();
     ~HUD();
 
-    void renderizar(QPainter& painter, Nivel* nivel, int fps);
+    // Hilo de simulacion: copia lo que se va a mostrar de este nivel
+    static DatosHUD capturar(Nivel* nivel);
+
+    void renderizar(QPainter& painter, const DatosHUD& datos, int fps);
+
+    // Paneles que dibuja renderizar() para estos datos: con repintado
+    // parcial se agregan siempre (FPS, tiempo y barras cambian cada frame)
+    QRegion getRegion(const DatosHUD& datos) const;
+
+    // Overlay de rendimiento (F3): min/prom/p99 por seccion y grafica
+    void renderizarPerfilador(QPainter& painter, const Perfilador& perfilador);
 
     void setColorTexto(const QColor& color);
     void setColorFondo(const QColor& color);
@@ -1,6 +1,7 @@
 #include "jugador.h"
 #include "gestorsprites.h"
 #include <QColor>
+#include <algorithm>
 
 // ========== CONSTRUCTORES ==========
 
@@ -17,7 +18,7 @@ Jugador::Jugador()
     invencible(false), tiempoInvencibilidad(0.0f) {
 
     setDimensiones(48, 48);
-    cargarAnimaciones();
+    configurarAnimaciones();
 }
 
 Jugador::Jugador(const Vector2D& pos)
@@ -33,7 +34,7 @@ Jugador::Jugador(const Vector2D& pos)
     invencible(false), tiempoInvencibilidad(0.0f) {
 
     setDimensiones(48, 48);
-    cargarAnimaciones();
+    configurarAnimaciones();
 }
 
 Jugador::~Jugador() {
@@ -41,20 +42,17 @@ Jugador::~Jugador() {
 
 // ========== CARGAR ANIMACIONES ==========
 
-void Jugador::cargarAnimaciones() {
-    GestorSprites* gestor = GestorSprites::obtenerInstancia();
-
-    QPixmap idle = gestor->getSprite("jugador_idle");
-    QPixmap swim = gestor->getSprite("jugador_swim");
-    QPixmap hurt = gestor->getSprite("jugador_hurt");
-    QPixmap death = gestor->getSprite("jugador_death");
+void Jugador::configurarAnimaciones() {
+    // Solo ids, tiempos y tamaños: el jugador puede simularse en otro
+    // hilo (idSprite no crea el gestor ni QPixmap)
 
     // ===== CICLOS POR SEGUNDO (cuantas veces se repite la animacion completa) =====
     // Valores altos = animacion SUPER RAPIDA
-    if (!idle.isNull()) animIdle = AnimacionSprite(idle, 64, 64, 6, 8.0f);
-    if (!swim.isNull()) animSwim = AnimacionSprite(swim, 64, 64, 6, 10.0f);
-    if (!hurt.isNull()) animHurt = AnimacionSprite(hurt, 64, 64, 3, 12.0f);
-    if (!death.isNull()) animDeath = AnimacionSprite(death, 64, 64, 6, 3.0f);
+    // Frames de 48x48 en una fila (jugador_idle.png = 288x48 = 6 frames)
+    animIdle = AnimacionSprite(GestorSprites::idSprite("jugador_idle"), 48, 48, 6, 8.0f);
+    animSwim = AnimacionSprite(GestorSprites::idSprite("jugador_swim"), 48, 48, 6, 10.0f);
+    animHurt = AnimacionSprite(GestorSprites::idSprite("jugador_hurt"), 48, 48, 3, 12.0f);
+    animDeath = AnimacionSprite(GestorSprites::idSprite("jugador_death"), 48, 48, 6, 3.0f);
 }
 
 // ========== METODOS HEREDADOS ==========
@@ -193,39 +191,34 @@ void Jugador::renderizarNadador(QPainter& painter) {
 
     painter.save();
 
-    // Obtener frame actual segun estado
-    QPixmap frameActual;
+    // Animacion segun estado
+    const AnimacionSprite* animacion = &animIdle;
 
     switch (estadoActual) {
     case EstadoAnimacion::IDLE:
-        frameActual = animIdle.getFrameActual();
+        animacion = &animIdle;
         break;
     case EstadoAnimacion::SWIM:
-        frameActual = animSwim.getFrameActual();
+        animacion = &animSwim;
         break;
     case EstadoAnimacion::HURT:
-        frameActual = animHurt.getFrameActual();
+        animacion = &animHurt;
         break;
     case EstadoAnimacion::DEATH:
-        frameActual = animDeath.getFrameActual();
+        animacion = &animDeath;
         break;
     }
 
     // Voltear horizontalmente si va a la izquierda
     bool mirandoDerecha = velocidad.x >= 0;
 
-    if (!frameActual.isNull()) {
-        QPixmap frame = frameActual.scaled(ancho * 1.5f, alto * 1.5f,
-                                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
-
-        if (!mirandoDerecha) {
-            frame = frame.transformed(QTransform().scale(-1, 1));
-        }
+    // El frame sale del atlas; escala y volteo se calculan una vez por variante
+    bool dibujado = GestorSprites::obtenerInstancia()->dibujarSprite(
+        painter, posicion.x - ancho * 0.25f, posicion.y - alto * 0.25f,
+        animacion->getSprite(), ancho * 1.5f, alto * 1.5f,
+        !mirandoDerecha, Qt::KeepAspectRatio, animacion->getRecorteActual());
 
-        painter.drawPixmap(posicion.x - ancho * 0.25f,
-                           posicion.y - alto * 0.25f,
-                           frame);
-    } else {
+    if (!dibujado) {
         // Fallback
         painter.setBrush(QColor(255, 200, 150));
         painter.setPen(Qt::black);
@@ -235,6 +228,13 @@ void Jugador::renderizarNadador(QPainter& painter) {
     painter.restore();
 }
 
+QRectF Jugador::getLimitesVisuales() const {
+    // El nadador se dibuja a 1.5x centrado; la barra de vida, 10 px arriba
+    float margenArriba = std::max(alto * 0.25f, 10.0f);
+    return QRectF(posicion.x - ancho * 0.25f, posicion.y - margenArriba,
+                  ancho * 1.5f, alto * 1.25f + margenArriba);
+}
+
 void Jugador::onColision(Entidad* otra) {
     if (!otra || invencible) return;
 
@@ -2,13 +2,16 @@
 #define JUGADOR_H
 
 #include "entidad.h"
+#include "atlastexturas.h"
 #include <QPainter>
 #include <QPixmap>
+#include <QRect>
+#include <QString>
 
 // Clase de animacion para sprite sheets
 class AnimacionSprite {
 private:
-    QPixmap spriteSheet;
+    SpriteId sprite;            // Sprite sheet en GestorSprites
     int frameAncho;
     int frameAlto;
     int numFrames;
@@ -17,12 +20,14 @@ private:
     float tiempoAcumulado;
 
 public:
-    AnimacionSprite() : frameAncho(64), frameAlto(64), numFrames(1), frameActual(0),
+    AnimacionSprite() : sprite(SPRITE_INVALIDO), frameAncho(64), frameAlto(64), numFrames(1), frameActual(0),
         duracionCicloCompleto(1.0f), tiempoAcumulado(0.0f) {}
 
     // ciclosSegundo = cuantas veces se repite la animacion completa por segundo
-    AnimacionSprite(const QPixmap& sheet, int ancho, int alto, int frames, float ciclosSegundo)
-        : spriteSheet(sheet), frameAncho(ancho), frameAlto(alto), numFrames(frames),
+    // Solo guarda el id del sprite: la animacion no toca QPixmap y
+    // puede avanzar en hilos sin GUI
+    AnimacionSprite(SpriteId idSprite, int ancho, int alto, int frames, float ciclosSegundo)
+        : sprite(idSprite), frameAncho(ancho), frameAlto(alto), numFrames(frames),
         frameActual(0), duracionCicloCompleto(1.0f / ciclosSegundo), tiempoAcumulado(0.0f) {}
 
     void actualizar(float dt) {
@@ -33,12 +38,13 @@ public:
         frameActual = (int)(tiempoAcumulado / tiempoPorFrame) % numFrames;
     }
 
-    QPixmap getFrameActual() const {
-        if (spriteSheet.isNull()) return QPixmap();
-        int x = frameActual * frameAncho;
-        return spriteSheet.copy(x, 0, frameAncho, frameAlto);
+    // Zona del sprite sheet con el frame actual (frames en una fila)
+    QRect getRecorteActual() const {
+        return QRect(frameActual * frameAncho, 0, frameAncho, frameAlto);
     }
 
+    SpriteId getSprite() const { return sprite; }
+
     void reiniciar() {
         frameActual = 0;
         tiempoAcumulado = 0.0f;
@@ -82,7 +88,7 @@ private:
     bool invencible;
     float tiempoInvencibilidad;
 
-    void cargarAnimaciones();
+    void configurarAnimaciones();
 
 public:
     // ========== CONSTRUCTORES ==========
@@ -95,6 +101,7 @@ public:
     void renderizar(QPainter& painter) override;
     void renderizarNadador(QPainter& painter);
     void onColision(Entidad* otra) override;
+    QRectF getLimitesVisuales() const override;
 
     // ========== MOVIMIENTO ==========
     void mover(const Vector2D& direccion, float dt);
@@ -0,0 +1,495 @@
+#include "lotedibujo.h"
+#include <QLineF>
+#include <QTextItem>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+double cruz(const QPointF& a, const QPointF& b) {
+    return a.x() * b.y() - a.y() * b.x();
+}
+
+bool dentroTriangulo(const QPointF& p, const QPointF& a, const QPointF& b, const QPointF& c) {
+    double d1 = cruz(b - a, p - a);
+    double d2 = cruz(c - b, p - b);
+    double d3 = cruz(a - c, p - c);
+
+    bool negativo = d1 < 0 || d2 < 0 || d3 < 0;
+    bool positivo = d1 > 0 || d2 > 0 || d3 > 0;
+    return !(negativo && positivo);
+}
+
+// Triangula un poligono simple recortando orejas (indices de a tres).
+// Los del juego tienen de 3 a 8 puntos: el costo cuadratico no importa.
+// Si el poligono se cruza y no quedan orejas, lo que falta va en abanico
+void triangular(const QPointF* puntos, int cantidad, std::vector<int>& indices) {
+    indices.clear();
+
+    double area = 0.0;
+    for (int i = 0; i < cantidad; i++) {
+        area += cruz(puntos[i], puntos[(i + 1) % cantidad]);
+    }
+    if (area == 0.0) return;
+    double sentido = area > 0.0 ? 1.0 : -1.0;
+
+    std::vector<int> restantes(cantidad);
+    for (int i = 0; i < cantidad; i++) {
+        restantes[i] = i;
+    }
+
+    while (restantes.size() > 3) {
+        size_t m = restantes.size();
+        bool recortada = false;
+
+        for (size_t i = 0; i < m && !recortada; i++) {
+            int a = restantes[(i + m - 1) % m];
+            int b = restantes[i];
+            int c = restantes[(i + 1) % m];
+
+            // Vertice reflejo o colineal: no es oreja
+            if (cruz(puntos[b] - puntos[a], puntos[c] - puntos[b]) * sentido <= 0.0) continue;
+
+            bool vacia = true;
+            for (int k : restantes) {
+                if (k != a && k != b && k != c &&
+                    dentroTriangulo(puntos[k], puntos[a], puntos[b], puntos[c])) {
+                    vacia = false;
+                    break;
+                }
+            }
+            if (!vacia) continue;
+
+            indices.push_back(a);
+            indices.push_back(b);
+            indices.push_back(c);
+            restantes.erase(restantes.begin() + i);
+            recortada = true;
+        }
+
+        if (!recortada) break;
+    }
+
+    for (size_t i = 1; i + 1 < restantes.size(); i++) {
+        indices.push_back(restantes[0]);
+        indices.push_back(restantes[i]);
+        indices.push_back(restantes[i + 1]);
+    }
+}
+
+void premultiplicar(const QColor& color, quint8* rgba) {
+    QRgb p = qPremultiply(color.rgba());
+    rgba[0] = static_cast<quint8>(qRed(p));
+    rgba[1] = static_cast<quint8>(qGreen(p));
+    rgba[2] = static_cast<quint8>(qBlue(p));
+    rgba[3] = static_cast<quint8>(qAlpha(p));
+}
+
+QColor conOpacidad(QColor color, qreal opacidad) {
+    if (opacidad < 1.0) {
+        color.setAlphaF(color.alphaF() * opacidad);
+    }
+    return color;
+}
+
+} // namespace
+
+// ========================================
+// MOTOR DE PINTURA
+// ========================================
+
+MotorPinturaLote::MotorPinturaLote(LoteDibujo* loteDestino)
+    : QPaintEngine(QPaintEngine::AllFeatures),
+    lote(loteDestino),
+    opacidad(1.0) {
+}
+
+bool MotorPinturaLote::begin(QPaintDevice* dispositivo) {
+    Q_UNUSED(dispositivo);
+
+    transformacion = QTransform();
+    pen = QPen();
+    brush = QBrush();
+    fuente = QFont();
+    opacidad = 1.0;
+    return true;
+}
+
+bool MotorPinturaLote::end() {
+    return true;
+}
+
+void MotorPinturaLote::updateState(const QPaintEngineState& estado) {
+    QPaintEngine::DirtyFlags cambios = estado.state();
+
+    if (cambios & DirtyTransform) transformacion = estado.transform();
+    if (cambios & DirtyPen) pen = estado.pen();
+    if (cambios & DirtyBrush) brush = estado.brush();
+    if (cambios & DirtyFont) fuente = estado.font();
+    if (cambios & DirtyOpacity) opacidad = estado.opacity();
+}
+
+// ===== SOPORTE =====
+
+bool MotorPinturaLote::rellenoSoportado() const {
+    return brush.style() == Qt::NoBrush || brush.style() == Qt::SolidPattern;
+}
+
+bool MotorPinturaLote::trazoSoportado() const {
+    return pen.style() == Qt::NoPen ||
+           (pen.style() == Qt::SolidLine && pen.brush().style() == Qt::SolidPattern);
+}
+
+float MotorPinturaLote::grosorTrazo() const {
+    if (pen.style() == Qt::NoPen) return 0.0f;
+    // Ancho 0 = pluma cosmetica de un pixel
+    return pen.widthF() > 0.0 ? static_cast<float>(pen.widthF()) : 1.0f;
+}
+
+void MotorPinturaLote::diferirCamino(const QPainterPath& camino) {
+    if (camino.isEmpty()) return;
+
+    DibujoDiferido dibujo;
+    dibujo.instancia = lote->getNumInstancias();
+    dibujo.transformacion = transformacion;
+    dibujo.pen = pen;
+    dibujo.brush = brush;
+    dibujo.fuente = fuente;
+    dibujo.opacidad = opacidad;
+    dibujo.camino = camino;
+    lote->agregarDiferido(dibujo);
+}
+
+void MotorPinturaLote::agregarTrazo(const QPointF& desde, const QPointF& hasta, float extension) {
+    QPointF delta = hasta - desde;
+    double largo = std::hypot(delta.x(), delta.y());
+    if (largo <= 0.0) return;
+
+    // Un rectangulo a lo largo del segmento, centrado en la linea y
+    // alargado en los extremos segun el remate de la pluma
+    float grosor = grosorTrazo();
+    QPointF direccion = delta / largo;
+    QPointF normal(-direccion.y(), direccion.x());
+    double total = largo + 2.0 * extension;
+    QPointF origen = desde - direccion * extension - normal * (grosor * 0.5);
+
+    QTransform local(direccion.x() * total, direccion.y() * total,
+                     normal.x() * grosor, normal.y() * grosor,
+                     origen.x(), origen.y());
+
+    lote->agregarFigura(local, transformacion, FORMA_RECTANGULO,
+                        static_cast<float>(total), grosor,
+                        conOpacidad(pen.color(), opacidad), Qt::transparent, 0.0f);
+}
+
+// ===== PRIMITIVAS =====
+
+void MotorPinturaLote::drawRects(const QRectF* rects, int cantidad) {
+    float grosor = grosorTrazo();
+    QColor relleno = brush.style() == Qt::SolidPattern ? conOpacidad(brush.color(), opacidad) : QColor(Qt::transparent);
+    QColor borde = conOpacidad(pen.color(), opacidad);
+
+    bool soportado = rellenoSoportado() && trazoSoportado();
+
+    for (int i = 0; i < cantidad; i++) {
+        if (!soportado) {
+            QPainterPath camino;
+            camino.addRect(rects[i]);
+            diferirCamino(camino);
+            continue;
+        }
+
+        // El trazo va centrado en el borde: la figura crece medio grosor
+        QRectF r = rects[i].normalized().adjusted(-grosor * 0.5, -grosor * 0.5, grosor * 0.5, grosor * 0.5);
+        lote->agregarFigura(QTransform(r.width(), 0, 0, r.height(), r.x(), r.y()), transformacion,
+                            FORMA_RECTANGULO, r.width(), r.height(), relleno, borde, grosor);
+    }
+}
+
+void MotorPinturaLote::drawEllipse(const QRectF& rect) {
+    if (!rellenoSoportado() || !trazoSoportado()) {
+        QPainterPath camino;
+        camino.addEllipse(rect);
+        diferirCamino(camino);
+        return;
+    }
+
+    float grosor = grosorTrazo();
+    QColor relleno = brush.style() == Qt::SolidPattern ? conOpacidad(brush.color(), opacidad) : QColor(Qt::transparent);
+
+    QRectF r = rect.normalized().adjusted(-grosor * 0.5, -grosor * 0.5, grosor * 0.5, grosor * 0.5);
+    lote->agregarFigura(QTransform(r.width(), 0, 0, r.height(), r.x(), r.y()), transformacion,
+                        FORMA_ELIPSE, r.width(), r.height(), relleno,
+                        conOpacidad(pen.color(), opacidad), grosor);
+}
+
+void MotorPinturaLote::drawLines(const QLineF* lineas, int cantidad) {
+    if (pen.style() == Qt::NoPen) return;
+
+    if (!trazoSoportado()) {
+        QPainterPath camino;
+        for (int i = 0; i < cantidad; i++) {
+            camino.moveTo(lineas[i].p1());
+            camino.lineTo(lineas[i].p2());
+        }
+
+        QBrush anterior = brush;
+        brush = QBrush();
+        diferirCamino(camino);
+        brush = anterior;
+        return;
+    }
+
+    float extension = pen.capStyle() == Qt::FlatCap ? 0.0f : grosorTrazo() * 0.5f;
+    for (int i = 0; i < cantidad; i++) {
+        agregarTrazo(lineas[i].p1(), lineas[i].p2(), extension);
+    }
+}
+
+void MotorPinturaLote::drawPolygon(const QPointF* puntos, int cantidad, PolygonDrawMode modo) {
+    if (cantidad < 2) return;
+
+    bool cerrado = modo != PolylineMode;
+    bool rellenar = cerrado && brush.style() != Qt::NoBrush;
+
+    if ((rellenar && !rellenoSoportado()) || !trazoSoportado()) {
+        QPainterPath camino;
+        camino.moveTo(puntos[0]);
+        for (int i = 1; i < cantidad; i++) {
+            camino.lineTo(puntos[i]);
+        }
+        if (cerrado) {
+            camino.closeSubpath();
+        }
+        camino.setFillRule(modo == WindingMode ? Qt::WindingFill : Qt::OddEvenFill);
+
+        QBrush anterior = brush;
+        if (!cerrado) brush = QBrush();
+        diferirCamino(camino);
+        brush = anterior;
+        return;
+    }
+
+    // ===== RELLENO: UN TRIANGULO POR INSTANCIA =====
+    if (rellenar && cantidad >= 3) {
+        static thread_local std::vector<int> indices;
+        triangular(puntos, cantidad, indices);
+
+        QColor relleno = conOpacidad(brush.color(), opacidad);
+        auto exterior = [cantidad](int i, int j) {
+            return (i + 1) % cantidad == j || (j + 1) % cantidad == i;
+        };
+
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            int a = indices[t], b = indices[t + 1], c = indices[t + 2];
+            const QPointF& pa = puntos[a];
+            QPointF ab = puntos[b] - pa;
+            QPointF ac = puntos[c] - pa;
+
+            // Solo se suavizan los bordes del poligono, no las diagonales
+            // internas (se notaria la costura entre triangulos)
+            int aristas = (exterior(b, c) ? 1 : 0) | (exterior(c, a) ? 2 : 0) | (exterior(a, b) ? 4 : 0);
+
+            lote->agregarFigura(QTransform(ab.x(), ab.y(), ac.x(), ac.y(), pa.x(), pa.y()), transformacion,
+                                FORMA_TRIANGULO, 1.0f, 1.0f, relleno, Qt::transparent, 0.0f, aristas);
+        }
+    }
+
+    // ===== CONTORNO =====
+    if (pen.style() != Qt::NoPen) {
+        // Cerrado: cada lado se alarga medio grosor y tapa las esquinas
+        float extension = (!cerrado && pen.capStyle() == Qt::FlatCap) ? 0.0f : grosorTrazo() * 0.5f;
+        int lados = cerrado ? cantidad : cantidad - 1;
+
+        for (int i = 0; i < lados; i++) {
+            agregarTrazo(puntos[i], puntos[(i + 1) % cantidad], extension);
+        }
+    }
+}
+
+void MotorPinturaLote::drawPath(const QPainterPath& camino) {
+    diferirCamino(camino);
+}
+
+void MotorPinturaLote::drawPixmap(const QRectF& destino, const QPixmap& pixmap, const QRectF& fuenteRect) {
+    lote->agregarSprite(transformacion, destino, pixmap, fuenteRect, opacidad);
+}
+
+void MotorPinturaLote::drawTextItem(const QPointF& posicion, const QTextItem& texto) {
+    DibujoDiferido dibujo;
+    dibujo.instancia = lote->getNumInstancias();
+    dibujo.transformacion = transformacion;
+    dibujo.pen = pen;
+    dibujo.fuente = texto.font();
+    dibujo.opacidad = opacidad;
+    dibujo.posicion = posicion;
+    dibujo.texto = texto.text();
+    lote->agregarDiferido(dibujo);
+}
+
+// ========================================
+// LOTE
+// ========================================
+
+LoteDibujo::LoteDibujo()
+    : motor(nullptr),
+    tamano(800, 600),
+    escala(1.0) {
+    motor = new MotorPinturaLote(this);
+}
+
+LoteDibujo::~LoteDibujo() {
+    delete motor;
+    motor = nullptr;
+}
+
+void LoteDibujo::iniciar(const QSize& tamanoVista, qreal escalaVista) {
+    tamano = tamanoVista;
+    escala = escalaVista;
+
+    instancias.clear();
+    tramos.clear();
+    diferidos.clear();
+    texturas.clear();
+}
+
+// ========== GRABACION ==========
+
+int LoteDibujo::indiceTextura(const QPixmap& pixmap) {
+    // Pocas por frame (paginas del atlas y capas): busqueda lineal
+    qint64 clave = pixmap.cacheKey();
+    for (int i = 0; i < texturas.size(); i++) {
+        if (texturas[i].cacheKey() == clave) return i;
+    }
+
+    texturas.append(pixmap);
+    return texturas.size() - 1;
+}
+
+void LoteDibujo::agregarFigura(const QTransform& local, const QTransform& painter, FormaLote forma,
+                               float ancho, float alto, const QColor& relleno, const QColor& borde,
+                               float grosor, int aristas) {
+    if (ancho <= 0.0f || alto <= 0.0f) return;
+    if (relleno.alpha() == 0 && (grosor <= 0.0f || borde.alpha() == 0)) return;
+
+    QTransform t = local * painter;
+
+    InstanciaLote instancia;
+    instancia.eje[0] = static_cast<float>(t.m11());
+    instancia.eje[1] = static_cast<float>(t.m12());
+    instancia.eje[2] = static_cast<float>(t.m21());
+    instancia.eje[3] = static_cast<float>(t.m22());
+    instancia.traslacion[0] = static_cast<float>(t.dx());
+    instancia.traslacion[1] = static_cast<float>(t.dy());
+    std::fill(instancia.fuente, instancia.fuente + 4, 0.0f);
+    premultiplicar(relleno, instancia.relleno);
+    premultiplicar(borde, instancia.borde);
+    instancia.tamano[0] = ancho;
+    instancia.tamano[1] = alto;
+    instancia.grosor = grosor;
+    instancia.forma = static_cast<float>(forma);
+    instancia.aristas = static_cast<float>(aristas);
+
+    // Sin textura: sigue en el tramo en curso, sea cual sea su textura
+    if (tramos.empty()) {
+        tramos.push_back({getNumInstancias(), 0, -1});
+    }
+    tramos.back().cantidad++;
+
+    instancias.push_back(instancia);
+}
+
+void LoteDibujo::agregarSprite(const QTransform& painter, const QRectF& destino,
+                               const QPixmap& pixmap, const QRectF& fuente, qreal opacidad) {
+    if (pixmap.isNull() || destino.isEmpty() || fuente.isEmpty() || opacidad <= 0.0) return;
+
+    int textura = indiceTextura(pixmap);
+    QTransform t = QTransform(destino.width(), 0, 0, destino.height(), destino.x(), destino.y()) * painter;
+
+    // La fuente va en pixeles reales del pixmap (sin devicePixelRatio)
+    float anchoTextura = static_cast<float>(pixmap.width());
+    float altoTextura = static_cast<float>(pixmap.height());
+
+    InstanciaLote instancia;
+    instancia.eje[0] = static_cast<float>(t.m11());
+    instancia.eje[1] = static_cast<float>(t.m12());
+    instancia.eje[2] = static_cast<float>(t.m21());
+    instancia.eje[3] = static_cast<float>(t.m22());
+    instancia.traslacion[0] = static_cast<float>(t.dx());
+    instancia.traslacion[1] = static_cast<float>(t.dy());
+    instancia.fuente[0] = static_cast<float>(fuente.x()) / anchoTextura;
+    instancia.fuente[1] = static_cast<float>(fuente.y()) / altoTextura;
+    instancia.fuente[2] = static_cast<float>(fuente.width()) / anchoTextura;
+    instancia.fuente[3] = static_cast<float>(fuente.height()) / altoTextura;
+    instancia.relleno[0] = instancia.relleno[1] = instancia.relleno[2] = 0;
+    instancia.relleno[3] = static_cast<quint8>(qRound(qMin(opacidad, 1.0) * 255));
+    std::fill(instancia.borde, instancia.borde + 4, 0);
+    instancia.tamano[0] = static_cast<float>(destino.width());
+    instancia.tamano[1] = static_cast<float>(destino.height());
+    instancia.grosor = 0.0f;
+    instancia.forma = static_cast<float>(FORMA_SPRITE);
+    instancia.aristas = 0.0f;
+
+    // Otra textura corta el tramo; un tramo que aun no tenia la adopta
+    if (tramos.empty() || (tramos.back().textura != textura && tramos.back().textura != -1)) {
+        tramos.push_back({getNumInstancias(), 0, textura});
+    }
+    tramos.back().textura = textura;
+    tramos.back().cantidad++;
+
+    instancias.push_back(instancia);
+}
+
+void LoteDibujo::agregarDiferido(const DibujoDiferido& dibujo) {
+    diferidos.push_back(dibujo);
+}
+
+// ========== CONSULTA ==========
+
+void LoteDibujo::dibujarDiferido(QPainter& painter, const DibujoDiferido& dibujo) const {
+    painter.save();
+    painter.setTransform(dibujo.transformacion);
+    painter.setOpacity(dibujo.opacidad);
+    painter.setPen(dibujo.pen);
+
+    if (dibujo.camino.isEmpty()) {
+        painter.setFont(dibujo.fuente);
+        painter.drawText(dibujo.posicion, dibujo.texto);
+    } else {
+        painter.setBrush(dibujo.brush);
+        painter.drawPath(dibujo.camino);
+    }
+
+    painter.restore();
+}
+
+// ========== QPaintDevice ==========
+
+int LoteDibujo::metric(PaintDeviceMetric metrica) const {
+    // Como una ventana de 96 dpi: el texto y las capas miden igual que en pantalla
+    switch (metrica) {
+    case PdmWidth:
+        return tamano.width();
+    case PdmHeight:
+        return tamano.height();
+    case PdmWidthMM:
+        return qRound(tamano.width() * 25.4 / 96.0);
+    case PdmHeightMM:
+        return qRound(tamano.height() * 25.4 / 96.0);
+    case PdmNumColors:
+        return 0;
+    case PdmDepth:
+        return 32;
+    case PdmDpiX:
+    case PdmDpiY:
+    case PdmPhysicalDpiX:
+    case PdmPhysicalDpiY:
+        return 96;
+    case PdmDevicePixelRatio:
+        return qMax(1, qRound(escala));
+    case PdmDevicePixelRatioScaled:
+        return qRound(escala * devicePixelRatioFScale());
+    default:
+        return QPaintDevice::metric(metrica);
+    }
+}
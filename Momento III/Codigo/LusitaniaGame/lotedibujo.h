@@ -0,0 +1,176 @@
+#ifndef LOTEDIBUJO_H
+#define LOTEDIBUJO_H
+
+#include <QBrush>
+#include <QFont>
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPen>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+#include <QTransform>
+#include <QVector>
+#include <vector>
+
+// Una figura del lote: un quad unitario [0,1]² llevado a pantalla por
+// una transformacion afin. El shader lo pinta como rectangulo, elipse,
+// triangulo o sprite del atlas segun 'forma'. Se sube tal cual a la GPU
+// (un atributo por instancia), asi que solo lleva floats y bytes.
+struct InstanciaLote {
+    float eje[4];           // m11, m12, m21, m22 (como QTransform)
+    float traslacion[2];    // dx, dy (pixeles logicos)
+    float fuente[4];        // Sprite: x, y, ancho, alto normalizados en la textura
+    quint8 relleno[4];      // RGBA premultiplicado (sprite: solo alfa = opacidad)
+    quint8 borde[4];        // RGBA premultiplicado
+    float tamano[2];        // Ancho y alto locales, para el borde y el suavizado
+    float grosor;           // Grosor del borde hacia adentro (0 = sin borde)
+    float forma;            // FormaLote
+    float aristas;          // Triangulo: bits de las aristas exteriores (suavizadas)
+};
+
+enum FormaLote {
+    FORMA_RECTANGULO = 0,
+    FORMA_ELIPSE = 1,
+    FORMA_TRIANGULO = 2,
+    FORMA_SPRITE = 3
+};
+
+// Instancias consecutivas que se dibujan con la misma textura: una
+// llamada instanciada por tramo. Las figuras sin textura no cortan el
+// tramo en curso
+struct TramoLote {
+    int inicio;
+    int cantidad;
+    int textura;            // Indice en getTexturas(), -1 = ninguna todavia
+};
+
+// Lo que el lote no sabe convertir en instancias (texto, caminos,
+// degradados, trazos punteados): se guarda con el estado del painter y
+// se pinta con QPainter, entre las instancias anteriores y las siguientes
+struct DibujoDiferido {
+    int instancia;          // Instancias grabadas antes de este dibujo
+    QTransform transformacion;
+    QPen pen;
+    QBrush brush;
+    QFont fuente;
+    qreal opacidad;
+    QPainterPath camino;    // Vacio = texto
+    QPointF posicion;
+    QString texto;
+};
+
+class LoteDibujo;
+
+// Motor de pintura que no rasteriza: cada drawRect/drawEllipse/
+// drawPolygon/drawLine/drawPixmap del QPainter se vuelve una o pocas
+// instancias del lote, con la transformacion y los colores ya resueltos
+class MotorPinturaLote : public QPaintEngine {
+private:
+    LoteDibujo* lote;
+
+    // ===== ESTADO DEL PAINTER =====
+    QTransform transformacion;
+    QPen pen;
+    QBrush brush;
+    QFont fuente;
+    qreal opacidad;
+
+    bool rellenoSoportado() const;
+    bool trazoSoportado() const;
+    float grosorTrazo() const;
+    void diferirCamino(const QPainterPath& camino);
+    void agregarTrazo(const QPointF& desde, const QPointF& hasta, float extension);
+
+public:
+    static const QPaintEngine::Type TIPO = QPaintEngine::User;
+
+    explicit MotorPinturaLote(LoteDibujo* lote);
+
+    // Las versiones enteras (QRect, QLine, QPoint) convierten y llaman a estas
+    using QPaintEngine::drawRects;
+    using QPaintEngine::drawEllipse;
+    using QPaintEngine::drawLines;
+    using QPaintEngine::drawPolygon;
+
+    bool begin(QPaintDevice* dispositivo) override;
+    bool end() override;
+    void updateState(const QPaintEngineState& estado) override;
+
+    void drawRects(const QRectF* rects, int cantidad) override;
+    void drawEllipse(const QRectF& rect) override;
+    void drawLines(const QLineF* lineas, int cantidad) override;
+    void drawPolygon(const QPointF* puntos, int cantidad, PolygonDrawMode modo) override;
+    void drawPath(const QPainterPath& camino) override;
+    void drawPixmap(const QRectF& destino, const QPixmap& pixmap, const QRectF& fuente) override;
+    void drawTextItem(const QPointF& posicion, const QTextItem& texto) override;
+
+    Type type() const override { return TIPO; }
+};
+
+// Lote de dibujo de un frame (backend OpenGL)
+// Es un QPaintDevice: se abre un QPainter sobre el y el mismo
+// renderizar() de siempre graba figuras en vez de pintar pixeles.
+// RenderizadorGL lo sube despues en un solo buffer y lo dibuja con una
+// llamada instanciada por textura, sin rasterizar nada en la CPU.
+//
+// Solo usa QtGui (nada de OpenGL): se graba y se mide sin ventana.
+class LoteDibujo : public QPaintDevice {
+private:
+    MotorPinturaLote* motor;
+    QSize tamano;
+    qreal escala;               // devicePixelRatio de la ventana
+
+    std::vector<InstanciaLote> instancias;
+    std::vector<TramoLote> tramos;
+    std::vector<DibujoDiferido> diferidos;
+    QVector<QPixmap> texturas;  // Paginas del atlas y capas usadas en el frame
+
+    int indiceTextura(const QPixmap& pixmap);
+
+public:
+    // ========== CONSTRUCTOR ==========
+    LoteDibujo();
+    ~LoteDibujo();
+
+    LoteDibujo(const LoteDibujo&) = delete;
+    LoteDibujo& operator=(const LoteDibujo&) = delete;
+
+    // Vacia el lote para grabar un frame nuevo (conserva la memoria)
+    void iniciar(const QSize& tamanoVista, qreal escalaVista);
+
+    // ========== GRABACION (MotorPinturaLote) ==========
+    // 'local' lleva el quad unitario a coordenadas del painter
+    void agregarFigura(const QTransform& local, const QTransform& painter, FormaLote forma,
+                       float ancho, float alto, const QColor& relleno, const QColor& borde,
+                       float grosor, int aristas = 0);
+    void agregarSprite(const QTransform& painter, const QRectF& destino,
+                       const QPixmap& pixmap, const QRectF& fuente, qreal opacidad);
+    void agregarDiferido(const DibujoDiferido& dibujo);
+
+    // ========== CONSULTA ==========
+    const std::vector<InstanciaLote>& getInstancias() const { return instancias; }
+    const std::vector<TramoLote>& getTramos() const { return tramos; }
+    const std::vector<DibujoDiferido>& getDiferidos() const { return diferidos; }
+    const QVector<QPixmap>& getTexturas() const { return texturas; }
+    int getNumInstancias() const { return static_cast<int>(instancias.size()); }
+    QSize getTamano() const { return tamano; }
+
+    void dibujarDiferido(QPainter& painter, const DibujoDiferido& dibujo) const;
+
+    // Con el lote escalar y voltear no cuestan nada (lo hace la GPU):
+    // GestorSprites dibuja directo del atlas en vez de usar variantes
+    static bool esLote(const QPainter& painter) {
+        return painter.paintEngine() && painter.paintEngine()->type() == MotorPinturaLote::TIPO;
+    }
+
+    // ========== QPaintDevice ==========
+    QPaintEngine* paintEngine() const override { return motor; }
+
+protected:
+    int metric(PaintDeviceMetric metrica) const override;
+};
+
+#endif // LOTEDIBUJO_H
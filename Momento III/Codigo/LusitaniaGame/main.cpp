@@ -1,7 +1,9 @@
 #include "mainwindow.h"
 #include "gestorsprites.h"
 #include "gestorsonidos.h"
+#include "gamewidget.h"
 #include <QApplication>
+#include <QCommandLineParser>
 
 int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
@@ -11,23 +13,60 @@ int main(int argc, char *argv[]) {
     qDebug() << "║   Universidad de Antioquia - 2025           ║";
     qDebug() << "╚══════════════════════════════════════════════╝\n";
 
+    // ========== BACKEND DE RENDER ==========
+    // --render opengl (o LUSITANIA_RENDER=opengl): lotes instanciados
+    // sobre QOpenGLWidget. Sin GPU corre con Mesa llvmpipe
+    // (LIBGL_ALWAYS_SOFTWARE=1). Si no hay OpenGL 3.3 vuelve a QPainter
+    QCommandLineParser parser;
+    parser.setApplicationDescription("El Naufragio del Lusitania");
+    parser.addHelpOption();
+
+    QCommandLineOption opcionRender("render", "Backend de dibujo: qpainter u opengl.", "backend",
+                                    qEnvironmentVariable("LUSITANIA_RENDER", "qpainter"));
+    parser.addOption(opcionRender);
+
+    // ========== HILO DE SIMULACION ==========
+    // Por defecto la simulacion corre en su propio hilo y la GUI solo
+    // dibuja instantaneas; --simulacion gui la deja en el hilo de la GUI
+    QCommandLineOption opcionSimulacion("simulacion", "Donde corre la simulacion: hilo o gui.", "hilo",
+                                        qEnvironmentVariable("LUSITANIA_SIMULACION", "hilo"));
+    parser.addOption(opcionSimulacion);
+    parser.process(app);
+
+    if (parser.value(opcionRender) == "opengl") {
+        GameWidget::setBackendInicial(BackendRender::OPENGL);
+    }
+
+    if (parser.value(opcionSimulacion) == "gui") {
+        GameWidget::setSimulacionEnHilo(false);
+    }
+
     // ========== CARGAR SPRITES ==========
+    // Solo el menu antes de mostrar la ventana; el nivel 1 se decodifica
+    // en segundo plano y cada nivel precarga el siguiente
     GestorSprites* gestorSprites = GestorSprites::obtenerInstancia();
-    gestorSprites->cargarTodosLosSprites();
+    gestorSprites->cargarPaquete(GestorSprites::PAQUETE_MENU);
+    gestorSprites->precargarPaquete(1);
 
     // ========== CARGAR SONIDOS ==========
     GestorSonidos* gestorSonidos = GestorSonidos::obtenerInstancia();
     gestorSonidos->cargarTodosLosSonidos();
 
     // Crear ventana principal
-    MainWindow ventana;
-    ventana.show();
+    // En su propio bloque: al destruirse, ~GameWidget detiene y espera el
+    // hilo de simulacion, que usa los gestores hasta ese momento
+    int resultado = 0;
+    {
+        MainWindow ventana;
+        ventana.show();
 
-    int resultado = app.exec();
+        resultado = app.exec();
+    }
 
-    // Limpiar al salir
+    // Limpiar al salir (ya no queda ningun hilo usandolos)
     GestorSprites::destruirInstancia();
     GestorSonidos::destruirInstancia();
+    ArchivoAssets::destruirCompartido();     // Despues de ambos gestores
 
     return resultado;
 }
@@ -214,13 +214,8 @@ void MainWindow::onNuevoJuego() {
 
 void MainWindow::onPausar() {
     if (gameWidget) {
-        MotorJuego* motor = MotorJuego::obtenerInstancia();
-
-        if (motor->getEstado() == EstadoJuego::JUGANDO) {
-            gameWidget->pausarJuego();
-        } else if (motor->getEstado() == EstadoJuego::PAUSADO) {
-            gameWidget->reanudarJuego();
-        }
+        // El estado del motor solo se lee en el hilo de la simulacion
+        gameWidget->alternarPausa();
     }
 }
 
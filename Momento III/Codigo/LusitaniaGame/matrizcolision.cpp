@@ -0,0 +1,51 @@
+#include "matrizcolision.h"
+
+// ========== CONSTRUCTOR ==========
+
+MatrizColision::MatrizColision() {
+    permitirTodo();
+}
+
+// ========== CONFIGURACION ==========
+
+void MatrizColision::permitirTodo() {
+    uint32_t todas = (1u << NUM_TIPOS) - 1;
+
+    for (int i = 0; i < NUM_TIPOS; i++) {
+        mascaras[i] = todas;
+        disparadores[i] = 0;
+    }
+}
+
+void MatrizColision::ignorarTodo() {
+    for (int i = 0; i < NUM_TIPOS; i++) {
+        mascaras[i] = 0;
+        disparadores[i] = 0;
+    }
+}
+
+void MatrizColision::setColisiona(TipoEntidad a, TipoEntidad b, bool colisiona) {
+    if (colisiona) {
+        mascaras[indice(a)] |= capaDe(b);
+        mascaras[indice(b)] |= capaDe(a);
+    } else {
+        mascaras[indice(a)] &= ~capaDe(b);
+        mascaras[indice(b)] &= ~capaDe(a);
+
+        // Un par que no choca tampoco avisa
+        disparadores[indice(a)] &= ~capaDe(b);
+        disparadores[indice(b)] &= ~capaDe(a);
+    }
+}
+
+void MatrizColision::setDisparador(TipoEntidad a, TipoEntidad b, bool soloAviso) {
+    if (soloAviso) {
+        // Disparador implica que el par se prueba
+        setColisiona(a, b, true);
+        disparadores[indice(a)] |= capaDe(b);
+        disparadores[indice(b)] |= capaDe(a);
+    } else {
+        disparadores[indice(a)] &= ~capaDe(b);
+        disparadores[indice(b)] &= ~capaDe(a);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef MATRIZCOLISION_H
+#define MATRIZCOLISION_H
+
+#include "tipos.h"
+#include <cstdint>
+
+// Que pares de TipoEntidad se prueban en MotorFisica y como
+// Cada tipo es una capa (un bit) y tiene una mascara con las capas con
+// las que choca. Un par que no esta en la mascara se descarta antes de
+// mirar las cajas: ni colisionaCon, ni onColision, ni separacion.
+// Un par "disparador" avisa con onColision pero no se separa (zonas
+// como el vortice, o un torpedo que se destruye al tocar).
+//
+// La matriz es simetrica: setColisiona(a, b) tambien pone (b, a).
+// Por defecto todos chocan con todos y se separan; cada nivel la
+// ajusta en inicializar().
+class MatrizColision {
+public:
+    static constexpr int NUM_TIPOS = static_cast<int>(TipoEntidad::VORTICE) + 1;
+
+private:
+    uint32_t mascaras[NUM_TIPOS];       // Capas con las que choca cada tipo
+    uint32_t disparadores[NUM_TIPOS];   // Capas con las que solo avisa
+
+    static int indice(TipoEntidad t) { return static_cast<int>(t); }
+
+public:
+    // ========== CONSTRUCTOR ==========
+    MatrizColision();
+
+    // ========== CONFIGURACION ==========
+    void permitirTodo();                // Todos con todos, con separacion
+    void ignorarTodo();                 // Nadie con nadie
+    void setColisiona(TipoEntidad a, TipoEntidad b, bool colisiona);
+    void setDisparador(TipoEntidad a, TipoEntidad b, bool soloAviso);
+
+    // ========== CONSULTA ==========
+    static uint32_t capaDe(TipoEntidad t) { return 1u << indice(t); }
+
+    bool colisionan(TipoEntidad a, TipoEntidad b) const {
+        return (mascaras[indice(a)] & capaDe(b)) != 0;
+    }
+    bool esDisparador(TipoEntidad a, TipoEntidad b) const {
+        return (disparadores[indice(a)] & capaDe(b)) != 0;
+    }
+    // false = el tipo no choca con nada (ni entra al par)
+    bool tieneColisiones(TipoEntidad t) const {
+        return mascaras[indice(t)] != 0;
+    }
+    uint32_t getMascara(TipoEntidad t) const { return mascaras[indice(t)]; }
+};
+
+#endif // MATRIZCOLISION_H
@@ -1,19 +1,65 @@
 #include "motorfisica.h"
+#include "perfilador.h"
+#include "fisicaflotacion.h"
+#include "fisicavortice.h"
+#include "trayectoriaparabolica.h"
+#include "movimientocircular.h"
+#include "osciladorarmonico.h"
 #include <algorithm>
+#include <limits>
+
+namespace {
+
+// Intervalo de t en que las proyecciones de a (movida d*t) y b se tocan
+// sobre un eje. false si no se tocan en ningun t
+bool intervaloEje(float a, float largoA, float d, float b, float largoB,
+                  float& entrada, float& salida) {
+    if (d == 0.0f) {
+        // Quieta en este eje: se tocan todo el paso o nunca
+        if (a + largoA < b || a > b + largoB) return false;
+
+        entrada = -std::numeric_limits<float>::infinity();
+        salida = std::numeric_limits<float>::infinity();
+        return true;
+    }
+
+    float t1 = (b - (a + largoA)) / d;
+    float t2 = (b + largoB - a) / d;
+    entrada = std::min(t1, t2);
+    salida = std::max(t1, t2);
+    return true;
+}
+
+} // namespace
 
 // ========== CONSTRUCTOR ==========
 
 MotorFisica::MotorFisica()
     : gravedad(9.8f),
-    gravedadActiva(false) {
+    gravedadActiva(false),
+    broadphaseActiva(true),
+    colisionContinua(true),
+    despachoPorLotes(true),
+    lotesSucios(true),
+    umbralSueno(5.0f),
+    pasosSueno(30) {
     // Constructor por defecto
     // Gravedad desactivada por defecto (se activa por nivel)
+    // Grid con el tamanio por defecto de Nivel (cada nivel lo ajusta)
+    grid.configurar(2000.0f, 1200.0f, 128.0f);
 }
 
 MotorFisica::MotorFisica(float g)
     : gravedad(g),
-    gravedadActiva(true) {
+    gravedadActiva(true),
+    broadphaseActiva(true),
+    colisionContinua(true),
+    despachoPorLotes(true),
+    lotesSucios(true),
+    umbralSueno(5.0f),
+    pasosSueno(30) {
     // Constructor con gravedad personalizada
+    grid.configurar(2000.0f, 1200.0f, 128.0f);
 }
 
 MotorFisica::~MotorFisica() {
@@ -23,41 +69,132 @@ MotorFisica::~MotorFisica() {
 // ========== CICLO PRINCIPAL ==========
 
 void MotorFisica::actualizar(float dt) {
-    // 1. Aplicar fisica a todas las entidades
-    aplicarFisica(dt);
+    // 0. Borrar las entidades que quedaron inactivas en el paso anterior
+    registro.liberarPendientes();
+    guardarInicioRapidas();
 
+    // 1. Aplicar fisica a todas las entidades
     // 2. Aplicar gravedad (si esta activa)
-    if (gravedadActiva) {
-        aplicarGravedad(dt);
+    {
+        TemporizadorPerfil t(SeccionPerfil::FISICA);
+        aplicarFisica(dt);
+
+        if (gravedadActiva) {
+            aplicarGravedad(dt);
+        }
     }
 
     // 3. Actualizar todas las entidades
-    for (auto* entidad : entidades) {
-        if (entidad && entidad->estaActivo()) {
-            entidad->actualizar(dt);
+    {
+        TemporizadorPerfil t(SeccionPerfil::ENTIDADES);
+        for (auto* entidad : registro.getDensas()) {
+            if (entidad && entidad->estaActivo() && !entidad->estaDormido()) {
+                entidad->actualizar(dt);
+            }
         }
     }
 
     // 4. Verificar colisiones
-    verificarColisiones();
+    {
+        TemporizadorPerfil t(SeccionPerfil::COLISIONES);
+        verificarColisiones();
+    }
+
+    // 5. Dormir las que llevan varios pasos quietas
+    actualizarSueno();
 
-    // 5. Eliminar entidades inactivas
+    // 6. Eliminar entidades inactivas
     eliminarEntidadesInactivas();
 }
 
 void MotorFisica::aplicarFisica(float dt) {
-    // Aplicar componentes de fisica a las entidades que los tienen
-    for (auto* entidad : entidades) {
-        if (entidad && entidad->estaActivo()) {
+    if (!despachoPorLotes) {
+        // Aplicar componentes de fisica a las entidades que los tienen
+        for (auto* entidad : registro.getDensas()) {
+            if (entidad && entidad->estaActivo() && !entidad->estaDormido()) {
+                entidad->aplicarFisica(dt);
+            }
+        }
+        return;
+    }
+
+    // Cada componente solo lee y mueve a su entidad, asi que correrlos
+    // por tipo da el mismo resultado que en el orden del arreglo
+    if (lotesSucios) {
+        agruparPorFisica();
+    }
+
+    aplicarLoteFisica<FisicaFlotacion, TipoFisica::FLOTACION>(dt);
+    aplicarLoteFisica<FisicaVortice, TipoFisica::VORTICE>(dt);
+    aplicarLoteFisica<TrayectoriaParabolica, TipoFisica::PARABOLICA>(dt);
+    aplicarLoteFisica<MovimientoCircular, TipoFisica::CIRCULAR>(dt);
+    aplicarLoteFisica<OsciladorArmonico, TipoFisica::OSCILADOR>(dt);
+
+    // Componentes sin grupo propio: llamada virtual
+    for (auto* entidad : lotesFisica[static_cast<int>(TipoFisica::OTRA)]) {
+        if (!entidad->estaActivo() || entidad->estaDormido()) continue;
+
+        ComponenteFisica* fisica = entidad->getFisica();
+        if (fisica && fisica->getTipoFisica() != TipoFisica::OTRA) {
+            lotesSucios = true;
+        }
+        entidad->aplicarFisica(dt);
+    }
+
+    // Las que no tenian componente al agrupar pueden haber recibido uno
+    for (auto* entidad : sinFisica) {
+        if (!entidad->estaActivo() || entidad->estaDormido()) continue;
+
+        if (entidad->getFisica()) {
+            lotesSucios = true;
+            entidad->aplicarFisica(dt);
+        }
+    }
+}
+
+template <typename T, TipoFisica TIPO>
+void MotorFisica::aplicarLoteFisica(float dt) {
+    for (auto* entidad : lotesFisica[static_cast<int>(TIPO)]) {
+        if (!entidad->estaActivo() || entidad->estaDormido()) continue;
+
+        ComponenteFisica* fisica = entidad->getFisica();
+        if (!fisica || fisica->getTipoFisica() != TIPO) {
+            // Cambio de componente (setFisica) desde que se agrupo: este
+            // paso va por la llamada virtual y el siguiente se reagrupa
+            lotesSucios = true;
             entidad->aplicarFisica(dt);
+            continue;
+        }
+
+        // Llamada directa: T es final, no pasa por la tabla virtual
+        entidad->setPosicion(static_cast<T*>(fisica)->T::calcular(entidad, dt));
+    }
+}
+
+void MotorFisica::agruparPorFisica() {
+    for (auto& lote : lotesFisica) {
+        lote.clear();
+    }
+    sinFisica.clear();
+
+    // Dormidas e inactivas tambien entran (pueden despertar); el ciclo
+    // de cada grupo las salta. El orden del arreglo se conserva
+    for (auto* entidad : registro.getDensas()) {
+        ComponenteFisica* fisica = entidad->getFisica();
+        if (fisica) {
+            lotesFisica[static_cast<int>(fisica->getTipoFisica())].push_back(entidad);
+        } else {
+            sinFisica.push_back(entidad);
         }
     }
+
+    lotesSucios = false;
 }
 
 void MotorFisica::aplicarGravedad(float dt) {
     // Aplicar gravedad a entidades que no tienen fisica personalizada
-    for (auto* entidad : entidades) {
-        if (entidad && entidad->estaActivo()) {
+    for (auto* entidad : registro.getDensas()) {
+        if (entidad && entidad->estaActivo() && !entidad->estaDormido()) {
             // Solo aplicar gravedad si no tiene componente de fisica
             if (!entidad->getFisica()) {
                 Vector2D velocidad = entidad->getVelocidad();
@@ -71,27 +208,77 @@ void MotorFisica::aplicarGravedad(float dt) {
 // ========== COLISIONES ==========
 
 void MotorFisica::verificarColisiones() {
-    // Verificacion de colisiones: Para cada par de entidades, verificar si colisionan
+    if (broadphaseActiva) {
+        verificarColisionesGrid();
+    } else {
+        verificarColisionesFuerzaBruta();
+    }
+
+    if (colisionContinua) {
+        verificarColisionesContinuas();
+    }
+}
 
+void MotorFisica::verificarColisionesFuerzaBruta() {
+    // Verificacion de colisiones: Para cada par de entidades, verificar si colisionan
+    const std::vector<Entidad*>& entidades = registro.getDensas();
     size_t numEntidades = entidades.size();
 
     for (size_t i = 0; i < numEntidades; i++) {
         Entidad* e1 = entidades[i];
         if (!e1 || !e1->estaActivo()) continue;
+        if (!matriz.tieneColisiones(e1->getTipo())) continue;
 
         for (size_t j = i + 1; j < numEntidades; j++) {
             Entidad* e2 = entidades[j];
             if (!e2 || !e2->estaActivo()) continue;
 
-            // Verificar colision AABB
-            if (e1->colisionaCon(e2)) {
-                // Notificar a ambas entidades
-                e1->onColision(e2);
-                e2->onColision(e1);
+            procesarPar(e1, e2);
+        }
+    }
+}
 
-                // Resolver colision fisica
-                resolverColision(e1, e2);
-            }
+void MotorFisica::verificarColisionesGrid() {
+    // Broadphase: solo se prueban los pares que comparten celda
+    const std::vector<Entidad*>& entidades = registro.getDensas();
+    grid.construir(entidades);
+    grid.obtenerParesCandidatos(paresCandidatos);
+
+    for (const auto& par : paresCandidatos) {
+        Entidad* e1 = entidades[par.first];
+        Entidad* e2 = entidades[par.second];
+
+        // Un onColision anterior pudo desactivar alguna de las dos
+        if (!e1 || !e1->estaActivo()) continue;
+        if (!e2 || !e2->estaActivo()) continue;
+
+        procesarPar(e1, e2);
+    }
+}
+
+void MotorFisica::procesarPar(Entidad* e1, Entidad* e2) {
+    // Dos dormidas no se movieron: lo que pasaba entre ellas sigue igual
+    if (e1->estaDormido() && e2->estaDormido()) return;
+
+    // Pares que nunca interactuan: ni se miran las cajas
+    TipoEntidad t1 = e1->getTipo();
+    TipoEntidad t2 = e2->getTipo();
+    if (!matriz.colisionan(t1, t2)) return;
+
+    // Las rapidas van por verificarColisionesContinuas
+    if (colisionContinua && (e1->esMovimientoRapido() || e2->esMovimientoRapido())) return;
+
+    // Verificar colision AABB
+    if (e1->colisionaCon(e2)) {
+        despertarPorContacto(e1, e2);
+
+        // Notificar a ambas entidades
+        e1->onColision(e2);
+        e2->onColision(e1);
+
+        // Resolver colision fisica (los disparadores solo avisan)
+        if (!matriz.esDisparador(t1, t2)) {
+            resolverColision(e1, e2);
         }
     }
 }
@@ -99,6 +286,7 @@ void MotorFisica::verificarColisiones() {
 void MotorFisica::resolverColision(Entidad* e1, Entidad* e2) {
     if (!e1 || !e2) return;
 
+
     // Resolucion basica de colision (separacion)
     // Calcula el vector de penetracion y separa las entidades
 
@@ -109,6 +297,15 @@ void MotorFisica::resolverColision(Entidad* e1, Entidad* e2) {
     Vector2D centro1(c1.x + c1.ancho / 2, c1.y + c1.alto / 2);
     Vector2D centro2(c2.x + c2.ancho / 2, c2.y + c2.alto / 2);
 
+    // Apoyo para el sueño: la de arriba se apoya en la de abajo solo si
+    // esa ya esta sostenida (piso o dormida). Dos que se tocan mientras
+    // caen no se sostienen entre si
+    Entidad* arriba = (centro1.y < centro2.y) ? e1 : e2;
+    Entidad* abajo = (arriba == e1) ? e2 : e1;
+    if (abajo->estaApoyado() || abajo->estaDormido()) {
+        arriba->marcarApoyo();
+    }
+
     // Vector de separacion
     Vector2D separacion = centro1 - centro2;
 
@@ -144,50 +341,165 @@ void MotorFisica::resolverColision(Entidad* e1, Entidad* e2) {
     }
 }
 
-// ========== LIMPIEZA ==========
+// ========== COLISION CONTINUA ==========
 
-void MotorFisica::eliminarEntidadesInactivas() {
-    auto it = entidades.begin();
+void MotorFisica::guardarInicioRapidas() {
+    // Punto de partida del barrido, antes de que fisica y actualizar muevan
+    rapidas.clear();
+    if (!colisionContinua) return;
 
-    while (it != entidades.end()) {
-        if (*it && !(*it)->estaActivo()) {
-            // Liberar memoria y eliminar del vector
-            delete *it;
-            it = entidades.erase(it);
-        } else {
-            ++it;
+    for (auto* entidad : registro.getDensas()) {
+        if (entidad->estaActivo() && entidad->esMovimientoRapido()) {
+            entidad->guardarInicioPaso();
+            rapidas.push_back(entidad);
         }
     }
 }
 
-// ========== GESTION DE ENTIDADES ==========
+void MotorFisica::verificarColisionesContinuas() {
+    // Pocas rapidas (torpedos) contra todas: sin grid, la caja barrida
+    // puede cruzar muchas celdas y el rechazo por tipo ya es barato
+    const std::vector<Entidad*>& entidades = registro.getDensas();
+
+    // Un par de dos rapidas se barre desde cada una: se guarda (rapida,
+    // primera) al procesarlo para no notificarlo dos veces
+    std::vector<std::pair<Entidad*, Entidad*>> paresRapidos;
+
+    for (auto* rapida : rapidas) {
+        if (!rapida->estaActivo()) continue;
+
+        TipoEntidad tipo = rapida->getTipo();
+        if (!matriz.tieneColisiones(tipo)) continue;
+
+        Vector2D desplazamiento = rapida->getPosicion() - rapida->getPosicionInicioPaso();
+        CajaColision inicio = rapida->getColision();
+        inicio.x -= desplazamiento.x;
+        inicio.y -= desplazamiento.y;
+
+        // Solo cuenta el primer impacto del recorrido
+        Entidad* primera = nullptr;
+        float tPrimera = 2.0f;
+
+        for (auto* otra : entidades) {
+            if (otra == rapida || !otra->estaActivo()) continue;
+            if (!matriz.colisionan(tipo, otra->getTipo())) continue;
+
+            // Si la otra tambien es rapida, se barre el movimiento relativo
+            CajaColision caja = otra->getColision();
+            Vector2D relativo = desplazamiento;
+            if (otra->esMovimientoRapido()) {
+                Vector2D desplazamientoOtra = otra->getPosicion() - otra->getPosicionInicioPaso();
+                caja.x -= desplazamientoOtra.x;
+                caja.y -= desplazamientoOtra.y;
+                relativo -= desplazamientoOtra;
+            }
 
-void MotorFisica::agregarEntidad(Entidad* e) {
-    if (e) {
-        entidades.push_back(e);
+            float t;
+            if (tiempoDeImpacto(inicio, relativo, caja, t) && t < tPrimera) {
+                tPrimera = t;
+                primera = otra;
+            }
+        }
+
+        if (!primera) continue;
+
+        if (primera->esMovimientoRapido()) {
+            auto procesado = std::find(paresRapidos.begin(), paresRapidos.end(),
+                                       std::make_pair(primera, rapida));
+            if (procesado != paresRapidos.end()) continue;
+            paresRapidos.emplace_back(rapida, primera);
+        }
+
+        despertarPorContacto(rapida, primera);
+        rapida->onColision(primera);
+        primera->onColision(rapida);
+
+        if (!matriz.esDisparador(tipo, primera->getTipo()) && rapida->estaActivo()) {
+            // Se la deja en el punto de contacto y se separa como en el discreto
+            rapida->setPosicion(rapida->getPosicionInicioPaso() + desplazamiento * tPrimera);
+            resolverColision(rapida, primera);
+        }
     }
 }
 
-void MotorFisica::removerEntidad(Entidad* e) {
-    if (!e) return;
+bool MotorFisica::tiempoDeImpacto(const CajaColision& a, const Vector2D& d,
+                                  const CajaColision& b, float& t) {
+    float entradaX, salidaX, entradaY, salidaY;
+    if (!intervaloEje(a.x, a.ancho, d.x, b.x, b.ancho, entradaX, salidaX)) return false;
+    if (!intervaloEje(a.y, a.alto, d.y, b.y, b.alto, entradaY, salidaY)) return false;
+
+    // Se tocan cuando se tocan en los dos ejes a la vez
+    float entrada = std::max(entradaX, entradaY);
+    float salida = std::min(salidaX, salidaY);
+
+    if (entrada > salida || entrada > 1.0f || salida < 0.0f) return false;
+
+    t = std::max(entrada, 0.0f);    // Ya encimadas al inicio: t = 0
+    return true;
+}
+
+// ========== SUEÑO ==========
+
+void MotorFisica::actualizarSueno() {
+    for (auto* entidad : registro.getDensas()) {
+        if (entidad->estaActivo()) {
+            entidad->evaluarSueno(umbralSueno, pasosSueno);
+        }
+    }
+}
 
-    // Buscar y eliminar
-    auto it = std::find(entidades.begin(), entidades.end(), e);
+void MotorFisica::despertarPorContacto(Entidad* e1, Entidad* e2) {
+    if (e1->estaDormido() == e2->estaDormido()) return;
 
-    if (it != entidades.end()) {
-        delete *it;
-        entidades.erase(it);
+    // Solo despierta si la otra se mueve: una quieta apoyada en una
+    // dormida no la despierta (si no, se despertarian entre si para
+    // siempre). Un grupo que se toca se va despertando de a una, paso
+    // a paso, mientras el movimiento se propaga
+    Entidad* dormida = e1->estaDormido() ? e1 : e2;
+    Entidad* despierta = (dormida == e1) ? e2 : e1;
+
+    if (despierta->getVelocidad().magnitud() >= umbralSueno) {
+        dormida->despertar();
     }
 }
 
+// ========== LIMPIEZA ==========
+
+void MotorFisica::eliminarEntidadesInactivas() {
+    // Compactacion en una sola pasada (ver RegistroEntidades::compactar).
+    // Las inactivas no se borran todavia: sus handles ya no son validos,
+    // pero el puntero se libera al inicio del paso siguiente
+    int antes = registro.getCantidad();
+    registro.compactar();
+
+    if (registro.getCantidad() != antes) {
+        lotesSucios = true;
+    }
+}
+
+// ========== GESTION DE ENTIDADES ==========
+
+HandleEntidad MotorFisica::agregarEntidad(Entidad* e) {
+    lotesSucios = true;
+    return registro.agregar(e);
+}
+
+void MotorFisica::removerEntidad(Entidad* e) {
+    if (!e) return;
+
+    // Por handle, sin buscarla en el arreglo. No se borra aqui: puede
+    // estar en medio de un recorrido (onColision, actualizar)
+    registro.retirar(e->getHandle());
+}
+
 void MotorFisica::limpiarEntidades() {
     // Eliminar todas las entidades
-    for (auto* entidad : entidades) {
-        if (entidad) {
-            delete entidad;
-        }
-    }
-    entidades.clear();
+    registro.limpiar();
+    lotesSucios = true;
+}
+
+Entidad* MotorFisica::obtenerEntidad(const HandleEntidad& h) const {
+    return registro.obtener(h);
 }
 
 // ========== BUSQUEDA DE ENTIDADES ==========
@@ -195,7 +507,7 @@ void MotorFisica::limpiarEntidades() {
 std::vector<Entidad*> MotorFisica::obtenerEntidadesPorTipo(TipoEntidad tipo) {
     std::vector<Entidad*> resultado;
 
-    for (auto* entidad : entidades) {
+    for (auto* entidad : registro.getDensas()) {
         if (entidad && entidad->estaActivo() && entidad->getTipo() == tipo) {
             resultado.push_back(entidad);
         }
@@ -205,7 +517,7 @@ std::vector<Entidad*> MotorFisica::obtenerEntidadesPorTipo(TipoEntidad tipo) {
 }
 
 Entidad* MotorFisica::obtenerPrimeraEntidadPorTipo(TipoEntidad tipo) {
-    for (auto* entidad : entidades) {
+    for (auto* entidad : registro.getDensas()) {
         if (entidad && entidad->estaActivo() && entidad->getTipo() == tipo) {
             return entidad;
         }
@@ -217,7 +529,7 @@ Entidad* MotorFisica::obtenerPrimeraEntidadPorTipo(TipoEntidad tipo) {
 int MotorFisica::contarEntidadesPorTipo(TipoEntidad tipo) {
     int contador = 0;
 
-    for (auto* entidad : entidades) {
+    for (auto* entidad : registro.getDensas()) {
         if (entidad && entidad->estaActivo() && entidad->getTipo() == tipo) {
             contador++;
         }
@@ -228,12 +540,12 @@ int MotorFisica::contarEntidadesPorTipo(TipoEntidad tipo) {
 
 // ========== GETTERS ==========
 
-std::vector<Entidad*> MotorFisica::getEntidades() const {
-    return entidades;
+const std::vector<Entidad*>& MotorFisica::getEntidades() const {
+    return registro.getDensas();
 }
 
 int MotorFisica::getNumeroEntidades() const {
-    return entidades.size();
+    return registro.getCantidad();
 }
 
 float MotorFisica::getGravedad() const {
@@ -244,6 +556,42 @@ bool MotorFisica::getGravedadActiva() const {
     return gravedadActiva;
 }
 
+bool MotorFisica::getBroadphaseActiva() const {
+    return broadphaseActiva;
+}
+
+bool MotorFisica::getColisionContinua() const {
+    return colisionContinua;
+}
+
+bool MotorFisica::getDespachoPorLotes() const {
+    return despachoPorLotes;
+}
+
+int MotorFisica::contarDormidas() const {
+    int contador = 0;
+
+    for (auto* entidad : registro.getDensas()) {
+        if (entidad->estaActivo() && entidad->estaDormido()) {
+            contador++;
+        }
+    }
+
+    return contador;
+}
+
+const GridEspacial& MotorFisica::getGrid() const {
+    return grid;
+}
+
+const MatrizColision& MotorFisica::getMatrizColision() const {
+    return matriz;
+}
+
+MatrizColision& MotorFisica::getMatrizColision() {
+    return matriz;
+}
+
 // ========== SETTERS ==========
 
 void MotorFisica::setGravedad(float g) {
@@ -253,3 +601,28 @@ void MotorFisica::setGravedad(float g) {
 void MotorFisica::setGravedadActiva(bool activa) {
     gravedadActiva = activa;
 }
+
+void MotorFisica::setBroadphaseActiva(bool activa) {
+    broadphaseActiva = activa;
+}
+
+void MotorFisica::setColisionContinua(bool activa) {
+    colisionContinua = activa;
+}
+
+void MotorFisica::setDespachoPorLotes(bool activo) {
+    despachoPorLotes = activo;
+}
+
+void MotorFisica::setSueno(float umbralVelocidad, int pasos) {
+    umbralSueno = umbralVelocidad;
+    pasosSueno = pasos;
+}
+
+void MotorFisica::setMatrizColision(const MatrizColision& m) {
+    matriz = m;
+}
+
+void MotorFisica::setDimensionesMundo(float ancho, float alto, float tamanioCelda) {
+    grid.configurar(ancho, alto, tamanioCelda);
+}
@@ -2,21 +2,64 @@
 #define MOTORFISICA_H
 
 #include "entidad.h"
+#include "componentefisica.h"
 #include "tipos.h"
+#include "gridespacial.h"
+#include "matrizcolision.h"
+#include "registroentidades.h"
 #include <vector>
+#include <utility>
 
 // Motor de Fisica
 // Gestiona todas las entidades del juego
 // Aplica fisica y detecta colisiones
 class MotorFisica {
 private:
-    std::vector<Entidad*> entidades;    // Todas las entidades activas
+    RegistroEntidades registro;          // Todas las entidades (arreglo denso + handles)
     float gravedad;                      // Gravedad global (9.8 px/s²)
     bool gravedadActiva;                 // Si la gravedad esta activada
 
+    // Broadphase
+    GridEspacial grid;                   // Grid uniforme del mundo
+    bool broadphaseActiva;               // false = comparar todos los pares
+    std::vector<std::pair<int, int>> paresCandidatos;
+
+    // Que tipos chocan entre si (se filtra antes de las cajas)
+    MatrizColision matriz;
+
+    // Colision continua: las de movimiento rapido no pasan por el par
+    // discreto, se prueban con su caja barrida del paso
+    bool colisionContinua;
+    std::vector<Entidad*> rapidas;       // Las del paso actual
+
+    // Despacho de componentes: agrupados por tipo concreto, un ciclo sin
+    // llamadas virtuales por grupo (false = calcular() virtual entidad
+    // por entidad, en el orden del arreglo). Los grupos se rearman solo
+    // cuando cambia el conjunto de entidades o algun componente
+    static constexpr int NUM_TIPOS_FISICA = static_cast<int>(TipoFisica::OTRA) + 1;
+    bool despachoPorLotes;
+    bool lotesSucios;
+    std::vector<Entidad*> lotesFisica[NUM_TIPOS_FISICA];
+    std::vector<Entidad*> sinFisica;     // Se vigilan por si reciben componente
+
+    // Sueño: las que pueden dormir y siguen quietas dejan de simularse
+    float umbralSueno;                   // Velocidad (px/s) que cuenta como quieta
+    int pasosSueno;                      // Pasos quietos seguidos para dormirse
+
+    // Fisica
+    void agruparPorFisica();
+    template <typename T, TipoFisica TIPO>
+    void aplicarLoteFisica(float dt);
+
     // Colisiones
-    void verificarColisiones();
+    void verificarColisionesFuerzaBruta();
+    void verificarColisionesGrid();
+    void procesarPar(Entidad* e1, Entidad* e2);
     void resolverColision(Entidad* e1, Entidad* e2);
+    void guardarInicioRapidas();
+    void verificarColisionesContinuas();
+    void actualizarSueno();
+    void despertarPorContacto(Entidad* e1, Entidad* e2);
 
     // Limpieza
     void eliminarEntidadesInactivas();
@@ -31,26 +74,55 @@ public:
     void actualizar(float dt);
     void aplicarFisica(float dt);
     void aplicarGravedad(float dt);
+    void verificarColisiones();         // Grid o fuerza bruta (setBroadphaseActiva)
+
+    // Primer instante t en [0, 1] en que la caja a, movida por d, toca a b
+    static bool tiempoDeImpacto(const CajaColision& a, const Vector2D& d,
+                                const CajaColision& b, float& t);
 
     // ========== GESTION DE ENTIDADES ==========
-    void agregarEntidad(Entidad* e);
-    void removerEntidad(Entidad* e);
+    // El motor pasa a ser el dueño. Guardar el handle, no el puntero:
+    // la entidad se borra un paso despues de quedar inactiva
+    HandleEntidad agregarEntidad(Entidad* e);
+    void removerEntidad(Entidad* e);            // Diferido: sale al final del paso
     void limpiarEntidades();
 
+    // Handles (O(1)); nullptr si la entidad ya se retiro
+    Entidad* obtenerEntidad(const HandleEntidad& h) const;
+    template <typename T>
+    T* obtenerEntidad(const HandleEntidad& h) const {
+        return registro.obtenerComo<T>(h);
+    }
+
     // Busqueda de entidades
     std::vector<Entidad*> obtenerEntidadesPorTipo(TipoEntidad tipo);
     Entidad* obtenerPrimeraEntidadPorTipo(TipoEntidad tipo);
     int contarEntidadesPorTipo(TipoEntidad tipo);
 
     // ========== GETTERS ==========
-    std::vector<Entidad*> getEntidades() const;
+    const std::vector<Entidad*>& getEntidades() const;     // Sin copia: no agregar ni quitar mientras se recorre
     int getNumeroEntidades() const;
     float getGravedad() const;
     bool getGravedadActiva() const;
+    bool getBroadphaseActiva() const;
+    bool getColisionContinua() const;
+    bool getDespachoPorLotes() const;
+    int contarDormidas() const;
+    const GridEspacial& getGrid() const;
+    const MatrizColision& getMatrizColision() const;
+    MatrizColision& getMatrizColision();        // Para ajustarla en el nivel
 
     // ========== SETTERS ==========
     void setGravedad(float g);
     void setGravedadActiva(bool activa);
+    void setBroadphaseActiva(bool activa);
+    void setColisionContinua(bool activa);  // false = todas discretas (como antes)
+    void setDespachoPorLotes(bool activo);  // false = calcular() virtual por entidad
+    void setSueno(float umbralVelocidad, int pasos);
+    void setMatrizColision(const MatrizColision& m);
+
+    // Dimensiona el grid de colisiones segun el tamanio del nivel
+    void setDimensionesMundo(float ancho, float alto, float tamanioCelda = 128.0f);
 };
 
 #endif // MOTORFISICA_H
@@ -3,6 +3,7 @@
 #include "nivel1oceano.h"
 #include "nivel2barco.h"
 #include "nivel3submarino.h"
+#include "gestorsprites.h"
 
 // ===== INICIALIZACION DEL SINGLETON =====
 MotorJuego* MotorJuego::instancia = nullptr;
@@ -99,7 +100,7 @@ void MotorJuego::renderizar() {
 
 // ===== GESTION DE NIVELES =====
 
-void MotorJuego::cargarNivel(int numeroNivel) {
+void MotorJuego::cargarNivel(int numeroNivel, uint64_t semilla) {
     // Limpiar nivel anterior
     if (nivelActual) {
         delete nivelActual;
@@ -108,28 +109,37 @@ void MotorJuego::cargarNivel(int numeroNivel) {
 
     // Crear nuevo nivel segun el numero
     numeroNivelActual = numeroNivel;
+    nivelActual = crearNivel(numeroNivel, semilla);
 
-    switch (numeroNivel) {
-    case 1:
-        nivelActual = new Nivel1Oceano();
-        break;
-    case 2:
-        nivelActual = new Nivel2Barco();
-        break;
-    case 3:
-        nivelActual = new Nivel3Submarino();
-        break;
-    default:
+    if (!nivelActual) {
         // Nivel inválido, cargar nivel 1
-        nivelActual = new Nivel1Oceano();
+        nivelActual = crearNivel(1, semilla);
         numeroNivelActual = 1;
-        break;
     }
 
+    // Sprites de este nivel (normalmente ya precargados) y precarga del
+    // siguiente; siguienteNivel() pasa por aqui
+    GestorSprites::obtenerInstancia()->prepararNivel(numeroNivelActual);
+
     // Cambiar estado a jugando
     cambiarEstado(EstadoJuego::JUGANDO);
 }
 
+Nivel* MotorJuego::crearNivel(int numeroNivel, uint64_t semilla) {
+    // Fabrica de niveles: no toca el estado del singleton,
+    // asi el simulador headless puede crear instancias independientes
+    switch (numeroNivel) {
+    case 1:
+        return new Nivel1Oceano(semilla);
+    case 2:
+        return new Nivel2Barco(semilla);
+    case 3:
+        return new Nivel3Submarino(semilla);
+    default:
+        return nullptr;
+    }
+}
+
 void MotorJuego::siguienteNivel() {
     int siguienteNumero = numeroNivelActual + 1;
 
@@ -144,8 +154,10 @@ void MotorJuego::siguienteNivel() {
 }
 
 void MotorJuego::reiniciarNivel() {
-    // Recargar el nivel actual
-    cargarNivel(numeroNivelActual);
+    // Recargar el nivel actual con su misma semilla (cargarNivel borra el
+    // nivel, asi que se lee antes): el reinicio reproduce el mismo nivel
+    uint64_t semilla = nivelActual ? nivelActual->getSemilla() : 0;
+    cargarNivel(numeroNivelActual, semilla);
 }
 
 void MotorJuego::volverAlMenu() {
@@ -157,6 +169,9 @@ void MotorJuego::volverAlMenu() {
 
     numeroNivelActual = 0;
     cambiarEstado(EstadoJuego::MENU_PRINCIPAL);
+
+    // Liberar los niveles y dejar el 1 precargado para la proxima partida
+    GestorSprites::obtenerInstancia()->prepararNivel(0);
 }
 
 // ===== GESTION DE ESTADOS =====
@@ -2,6 +2,7 @@
 #define MOTORJUEGO_H
 
 #include "tipos.h"
+#include <cstdint>
 
 // Forward declarations
 class Nivel;
@@ -50,7 +51,9 @@ public:
     void renderizar();  // Se implementará cuando tengamos GUI
 
     // ===== GESTION DE NIVELES =====
-    void cargarNivel(int numeroNivel);
+    // semilla 0 = aleatoria; otra = partida reproducible
+    void cargarNivel(int numeroNivel, uint64_t semilla = 0);
+    static Nivel* crearNivel(int numeroNivel, uint64_t semilla = 0);   // nullptr si no existe
     void siguienteNivel();
     void reiniciarNivel();
     void volverAlMenu();
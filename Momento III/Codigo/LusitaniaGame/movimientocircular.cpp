@@ -7,7 +7,8 @@
 // ========== CONSTRUCTORES ==========
 
 MovimientoCircular::MovimientoCircular()
-    : radio(40.0f),                 // 40 pixeles de longitud de cuerda
+    : ComponenteFisica(TipoFisica::CIRCULAR),
+    radio(40.0f),                 // 40 pixeles de longitud de cuerda
     velocidadAngular(0.5f),       // Velocidad base
     centroPivote(0, 0),           // Se configurara despues
     anguloActual(0.0f) {
@@ -15,7 +16,8 @@ MovimientoCircular::MovimientoCircular()
 }
 
 MovimientoCircular::MovimientoCircular(float r, float w, const Vector2D& centro)
-    : radio(r), velocidadAngular(w),
+    : ComponenteFisica(TipoFisica::CIRCULAR),
+    radio(r), velocidadAngular(w),
     centroPivote(centro), anguloActual(0.0f) {
     // Constructor con parametros
 }
@@ -57,8 +59,9 @@ Vector2D MovimientoCircular::calcular(Entidad* e, float dt) {
     return calcularPosicionCircular(anguloActual);
 }
 
-void MovimientoCircular::aplicar(Entidad* e) {
+void MovimientoCircular::aplicar(Entidad* e, float dt) {
     if (!e) return;
+    (void)dt; // El angulo avanza en calcular()
 
     // Calcular nueva posicion en el circulo
     Vector2D nuevaPosicion = calcularPosicionCircular(anguloActual);
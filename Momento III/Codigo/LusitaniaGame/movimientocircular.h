@@ -11,7 +11,7 @@
 //   x(t) = x_centro + r × cos(θ)
 //   y(t) = y_centro + r × sin(θ)
 //   θ(t) = θ₀ + ω × t
-class MovimientoCircular : public ComponenteFisica {
+class MovimientoCircular final : public ComponenteFisica {
 private:
     float radio;                  // r - Radio del circulo (longitud de cuerda)
     float velocidadAngular;       // ω (omega) - Velocidad de rotacion
@@ -29,7 +29,7 @@ public:
 
     // ========== METODOS HEREDADOS ==========
     Vector2D calcular(Entidad* e, float dt) override;
-    void aplicar(Entidad* e) override;
+    void aplicar(Entidad* e, float dt) override;
 
     // ========== GETTERS Y SETTERS ==========
     float getRadio() const;
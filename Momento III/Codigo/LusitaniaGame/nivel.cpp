@@ -2,7 +2,7 @@
 
 // ========== CONSTRUCTOR ==========
 
-Nivel::Nivel()
+Nivel::Nivel(uint64_t semillaNivel)
     : motorFisica(nullptr),
     camara(nullptr),
     jugador(nullptr),
@@ -14,7 +14,10 @@ Nivel::Nivel()
     objetivosPrincipales(0),
     objetivosSecundarios(0),
     anchoNivel(2000),
-    altoNivel(1200) {
+    altoNivel(1200),
+    semilla(semillaNivel != 0 ? semillaNivel : GeneradorAleatorio::semillaNueva()),
+    generador(semilla),
+    interpolando(false) {
 
     // Crear motor de fisica
     motorFisica = new MotorFisica();
@@ -37,6 +40,23 @@ void Nivel::manejarInput(int tecla, bool presionada) {
     (void)presionada;
 }
 
+void Nivel::aplicarEntrada(const EntradaJugador& entrada, float dt) {
+    if (!jugador) return;
+
+    // No permitir movimiento si esta muriendo
+    if (jugador->estaEnAnimacionMuerte()) return;
+
+    if (entrada.direccion.magnitud() > 0.0f) {
+        jugador->mover(entrada.direccion, dt);
+    } else {
+        jugador->detener();
+    }
+
+    if (entrada.habilidad) {
+        jugador->usarHabilidad();
+    }
+}
+
 void Nivel::limpiar() {
     // Limpiar motor de fisica (esto elimina todas las entidades)
     if (motorFisica) {
@@ -53,6 +73,94 @@ void Nivel::limpiar() {
     jugador = nullptr;
 }
 
+// ========== INTERPOLACION ==========
+
+void Nivel::guardarEstadoAnterior() {
+    if (motorFisica) {
+        for (auto* entidad : motorFisica->getEntidades()) {
+            if (entidad) {
+                entidad->guardarPosicionAnterior();
+            }
+        }
+    }
+
+    if (camara) {
+        camara->guardarPosicionAnterior();
+    }
+}
+
+void Nivel::aplicarInterpolacion(float alpha) {
+    if (interpolando) return;
+
+    if (motorFisica) {
+        for (auto* entidad : motorFisica->getEntidades()) {
+            if (entidad) {
+                entidad->interpolarPosicion(alpha);
+            }
+        }
+    }
+
+    if (camara) {
+        camara->interpolarPosicion(alpha);
+    }
+
+    interpolando = true;
+}
+
+void Nivel::restaurarEstado() {
+    if (!interpolando) return;
+
+    if (motorFisica) {
+        for (auto* entidad : motorFisica->getEntidades()) {
+            if (entidad) {
+                entidad->restaurarPosicion();
+            }
+        }
+    }
+
+    if (camara) {
+        camara->restaurarPosicion();
+    }
+
+    interpolando = false;
+}
+
+// ========== REGIONES SUCIAS (CAMARA FIJA) ==========
+
+bool Nivel::calcularRegionSucia(QRegion& region) {
+    std::vector<QRect> zonas;
+    agregarZonasDinamicas(zonas);
+
+    bool parcial = camara && !camara->getTieneScroll();
+    if (parcial) {
+        // Lo de antes se borra (queda el fondo) y lo de ahora se dibuja
+        for (const QRect& zona : zonasAnteriores) {
+            region += zona;
+        }
+        for (const QRect& zona : zonas) {
+            region += zona;
+        }
+    }
+
+    // Se guardan aunque se repinte todo: el proximo frame parcial las usa
+    zonasAnteriores.swap(zonas);
+    return parcial;
+}
+
+void Nivel::agregarZonasDinamicas(std::vector<QRect>& zonas) const {
+    if (!motorFisica || !camara) return;
+
+    Vector2D offsetCamara = camara->getPosicion();
+
+    for (auto* entidad : motorFisica->getEntidades()) {
+        if (!entidad || !entidad->estaActivo()) continue;
+
+        // Margen para bordes gruesos y antialiasing
+        QRectF limites = entidad->getLimitesVisuales().translated(-offsetCamara.x, -offsetCamara.y);
+        zonas.push_back(limites.toAlignedRect().adjusted(-4, -4, 4, 4));
+    }
+}
+
 // ========== GETTERS ==========
 
 MotorFisica* Nivel::getMotorFisica() const {
@@ -95,6 +203,14 @@ int Nivel::getAltoNivel() const {
     return altoNivel;
 }
 
+uint64_t Nivel::getSemilla() const {
+    return semilla;
+}
+
+GeneradorAleatorio* Nivel::getGenerador() {
+    return &generador;
+}
+
 // ========== SETTERS ==========
 
 void Nivel::setCompletado(bool comp) {
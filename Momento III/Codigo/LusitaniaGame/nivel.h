@@ -5,8 +5,21 @@
 #include "camara.h"
 #include "jugador.h"
 #include "tipos.h"
+#include "generadoraleatorio.h"
 #include <QPainter>
+#include <QRect>
+#include <QRegion>
 #include <vector>
+#include <cstdint>
+
+// Entrada del jugador para un paso de simulacion
+// La construye SimulacionJuego (teclado) o el simulador headless (guion/aleatoria)
+struct EntradaJugador {
+    Vector2D direccion;     // Suma de direcciones (-1..1 en cada eje)
+    bool habilidad;         // Shift: habilidad especial
+
+    EntradaJugador() : direccion(0, 0), habilidad(false) {}
+};
 
 // Clase abstracta base para todos los niveles
 // Define la estructura comun: jugador, camara, fisica, condiciones
@@ -32,9 +45,24 @@ protected:
     int anchoNivel;                     // Ancho del mundo del nivel
     int altoNivel;                      // Alto del mundo del nivel
 
+    // ===== ALEATORIEDAD =====
+    uint64_t semilla;                   // Semilla del nivel (reproducible)
+    GeneradorAleatorio generador;       // Todos los spawns e IA usan este
+
+    // ===== INTERPOLACION =====
+    bool interpolando;                  // true entre aplicar y restaurar
+
+    // ===== REGIONES SUCIAS =====
+    std::vector<QRect> zonasAnteriores; // Zonas dinamicas del frame anterior (pantalla)
+
+    // Zonas de pantalla que pueden cambiar de un frame a otro. Por
+    // defecto, los limites visuales de las entidades activas del motor
+    virtual void agregarZonasDinamicas(std::vector<QRect>& zonas) const;
+
 public:
     // ========== CONSTRUCTOR Y DESTRUCTOR ==========
-    Nivel();
+    // semilla 0 = elegir una nueva
+    explicit Nivel(uint64_t semillaNivel = 0);
     virtual ~Nivel();
 
     // ========== METODOS VIRTUALES PUROS ==========
@@ -50,8 +78,23 @@ public:
 
     // ========== METODOS VIRTUALES (con implementacion base) ==========
     virtual void manejarInput(int tecla, bool presionada);
+    virtual void aplicarEntrada(const EntradaJugador& entrada, float dt);
     virtual void limpiar();
 
+    // ========== INTERPOLACION (PASO FIJO) ==========
+    // guardarEstadoAnterior() se llama antes de cada paso de simulacion;
+    // aplicarInterpolacion()/restaurarEstado() envuelven el render
+    virtual void guardarEstadoAnterior();
+    virtual void aplicarInterpolacion(float alpha);
+    virtual void restaurarEstado();
+
+    // ========== REGIONES SUCIAS (CAMARA FIJA) ==========
+    // Con la camara fija el fondo no se mueve: basta repintar lo que
+    // ocupan las partes dinamicas ahora y lo que ocupaban en el frame
+    // anterior. Devuelve false si hay que repintar todo (camara con
+    // scroll). Una vez por frame, con la interpolacion ya aplicada
+    bool calcularRegionSucia(QRegion& region);
+
     // ========== GETTERS =====
     MotorFisica* getMotorFisica() const;
     Camara* getCamara() const;
@@ -66,6 +109,9 @@ public:
     int getAnchoNivel() const;
     int getAltoNivel() const;
 
+    uint64_t getSemilla() const;
+    GeneradorAleatorio* getGenerador();
+
     // ========== SETTERS =====
     void setCompletado(bool comp);
     void setFallado(bool fall);
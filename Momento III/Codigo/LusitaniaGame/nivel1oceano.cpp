@@ -1,7 +1,6 @@
 #include "nivel1oceano.h"
 #include "gestorsprites.h"
 #include <QColor>
-#include <cstdlib>
 #include <cmath>
 
 #ifndef M_PI
@@ -10,15 +9,17 @@
 
 // ========== CONSTRUCTOR ==========
 
-Nivel1Oceano::Nivel1Oceano()
-    : Nivel(),
+Nivel1Oceano::Nivel1Oceano(uint64_t semillaNivel)
+    : Nivel(semillaNivel),
     posicionBarco(400, 200),
     oscilacionBarco(nullptr),
     tiempoSpawn(0.0f),
     intervaloSpawn(12.0f),
     maxSubmarinos(5),  //
     submarinosDestruidos(0),
-    torpedosEvadidos(0) {
+    torpedosEvadidos(0),
+    capaFondo(QRect(0, 0, 800, 600)),
+    capaBarco(QRect(-102, -97, 224, 139)) {
 
     anchoNivel = 1600;
     altoNivel = 800;
@@ -55,6 +56,16 @@ void Nivel1Oceano::inicializar() {
     spawnearSubmarino();
 
     motorFisica->setGravedadActiva(false);
+    motorFisica->setDimensionesMundo(anchoNivel, altoNivel);
+
+    // Colisiones: el torpedo no toca al submarino que lo dispara y se
+    // destruye con lo demas (avisa, no empuja)
+    MatrizColision& matriz = motorFisica->getMatrizColision();
+    matriz.ignorarTodo();
+    matriz.setColisiona(TipoEntidad::JUGADOR, TipoEntidad::ENEMIGO_SUBMARINO, true);
+    matriz.setColisiona(TipoEntidad::ENEMIGO_SUBMARINO, TipoEntidad::ENEMIGO_SUBMARINO, true);
+    matriz.setDisparador(TipoEntidad::JUGADOR, TipoEntidad::TORPEDO, true);
+    matriz.setDisparador(TipoEntidad::TORPEDO, TipoEntidad::TORPEDO, true);
 }
 
 // ========== ACTUALIZACION ==========
@@ -100,7 +111,7 @@ void Nivel1Oceano::actualizarSubmarinos(float /*dt*/) {
     auto it = submarinos.begin();
 
     while (it != submarinos.end()) {
-        Submarino* sub = *it;
+        Submarino* sub = motorFisica->obtenerEntidad<Submarino>(*it);
 
         if (!sub || !sub->estaActivo()) {
             it = submarinos.erase(it);
@@ -114,8 +125,7 @@ void Nivel1Oceano::actualizarSubmarinos(float /*dt*/) {
         if (sub->puedeDisparar() && sub->getEstado() == EstadoSubmarino::ATACANDO) {
             Torpedo* torpedo = sub->dispararTorpedo();
             if (torpedo) {
-                motorFisica->agregarEntidad(torpedo);
-                torpedos.push_back(torpedo);
+                torpedos.push_back(motorFisica->agregarEntidad(torpedo));
             }
         }
 
@@ -127,7 +137,7 @@ void Nivel1Oceano::actualizarTorpedos(float /*dt*/) {
     auto it = torpedos.begin();
 
     while (it != torpedos.end()) {
-        Torpedo* torpedo = *it;
+        Torpedo* torpedo = motorFisica->obtenerEntidad<Torpedo>(*it);
 
         if (!torpedo || !torpedo->estaActivo()) {
             it = torpedos.erase(it);
@@ -140,7 +150,9 @@ void Nivel1Oceano::actualizarTorpedos(float /*dt*/) {
 }
 
 void Nivel1Oceano::verificarColisionesTorpedos() {
-    for (auto* torpedo : torpedos) {
+    for (const auto& handle : torpedos) {
+        Torpedo* torpedo = motorFisica->obtenerEntidad<Torpedo>(handle);
+
         if (torpedo && torpedo->estaActivo() && jugador) {
             if (torpedo->colisionaCon(jugador)) {
                 jugador->recibirDanio(25.0f);
@@ -153,15 +165,14 @@ void Nivel1Oceano::verificarColisionesTorpedos() {
 void Nivel1Oceano::spawnearSubmarino() {
     Vector2D posCamara = camara->getPosicion();
 
-    float x = (rand() % 2 == 0) ? posCamara.x - 50.0f : posCamara.x + 850.0f;
-    float y = posCamara.y + 100.0f + (rand() % 400);
+    float x = (generador.entero(2) == 0) ? posCamara.x - 50.0f : posCamara.x + 850.0f;
+    float y = posCamara.y + 100.0f + generador.entero(400);
 
-    Submarino* sub = new Submarino(Vector2D(x, y));
+    Submarino* sub = new Submarino(Vector2D(x, y), &generador);
     sub->setObjetivo(jugador);
     sub->setProfundidad(y);
 
-    motorFisica->agregarEntidad(sub);
-    submarinos.push_back(sub);
+    submarinos.push_back(motorFisica->agregarEntidad(sub));
 }
 
 // ========== RENDERIZADO ==========
@@ -171,45 +182,54 @@ void Nivel1Oceano::renderizar(QPainter& painter) {
 
     painter.save();
 
-    // Fondo oceano claro
-    QLinearGradient gradient(0, 0, 0, 600);
-    gradient.setColorAt(0, QColor(50, 150, 220));
-    gradient.setColorAt(0.5, QColor(20, 100, 180));
-    gradient.setColorAt(1, QColor(0, 50, 120));
-    painter.fillRect(0, 0, 800, 600, gradient);
+    // Fondo oceano claro (el degradado se arma una sola vez)
+    capaFondo.dibujar(painter, [](QPainter& p) {
+        QLinearGradient gradient(0, 0, 0, 600);
+        gradient.setColorAt(0, QColor(50, 150, 220));
+        gradient.setColorAt(0.5, QColor(20, 100, 180));
+        gradient.setColorAt(1, QColor(0, 50, 120));
+        p.fillRect(0, 0, 800, 600, gradient);
+    });
 
     Vector2D offsetCamara = camara->getPosicion();
     painter.translate(-offsetCamara.x, -offsetCamara.y);
 
-    // Barco Lusitania
-    painter.setBrush(QColor(100, 50, 0));
-    painter.setPen(QPen(Qt::black, 2));
-
-    painter.drawRect(posicionBarco.x - 100, posicionBarco.y - 40, 200, 80);
-
-    QPolygon proa;
-    proa << QPoint(posicionBarco.x + 100, posicionBarco.y - 40)
-         << QPoint(posicionBarco.x + 120, posicionBarco.y)
-         << QPoint(posicionBarco.x + 100, posicionBarco.y + 40);
-    painter.drawPolygon(proa);
-
-    painter.setBrush(QColor(80, 40, 0));
-    painter.drawRect(posicionBarco.x - 90, posicionBarco.y - 60, 180, 20);
-
-    painter.setBrush(QColor(50, 25, 0));
-    painter.drawRect(posicionBarco.x - 60, posicionBarco.y - 80, 20, 20);
-    painter.drawRect(posicionBarco.x - 10, posicionBarco.y - 80, 20, 20);
-    painter.drawRect(posicionBarco.x + 40, posicionBarco.y - 80, 20, 20);
-
-    painter.setPen(Qt::NoPen);
-    painter.setBrush(QColor(100, 100, 100, 150));
-    painter.drawEllipse(posicionBarco.x - 55, posicionBarco.y - 95, 10, 15);
-    painter.drawEllipse(posicionBarco.x - 5, posicionBarco.y - 95, 10, 15);
-    painter.drawEllipse(posicionBarco.x + 45, posicionBarco.y - 95, 10, 15);
+    // Barco Lusitania: la forma no cambia, solo oscila su posicion.
+    // Se pinta alrededor de (0, 0) y se copia en posicionBarco
+    QRectF limitesBarco = QRectF(capaBarco.getArea()).translated(posicionBarco.x, posicionBarco.y);
+    if (camara->estaVisible(limitesBarco)) {
+        capaBarco.dibujar(painter, [](QPainter& p) {
+            p.setBrush(QColor(100, 50, 0));
+            p.setPen(QPen(Qt::black, 2));
+
+            p.drawRect(-100, -40, 200, 80);
+
+            QPolygon proa;
+            proa << QPoint(100, -40)
+                 << QPoint(120, 0)
+                 << QPoint(100, 40);
+            p.drawPolygon(proa);
+
+            p.setBrush(QColor(80, 40, 0));
+            p.drawRect(-90, -60, 180, 20);
+
+            p.setBrush(QColor(50, 25, 0));
+            p.drawRect(-60, -80, 20, 20);
+            p.drawRect(-10, -80, 20, 20);
+            p.drawRect(40, -80, 20, 20);
+
+            p.setPen(Qt::NoPen);
+            p.setBrush(QColor(100, 100, 100, 150));
+            p.drawEllipse(-55, -95, 10, 15);
+            p.drawEllipse(-5, -95, 10, 15);
+            p.drawEllipse(45, -95, 10, 15);
+        }, QPointF(posicionBarco.x, posicionBarco.y));
+    }
 
-    // Renderizar entidades
+    // Renderizar entidades (fuera de pantalla no se dibujan)
     for (auto* entidad : motorFisica->getEntidades()) {
-        if (entidad && entidad->estaActivo()) {
+        if (entidad && entidad->estaActivo() &&
+            camara->estaVisible(entidad->getLimitesVisuales())) {
             entidad->renderizar(painter);
         }
     }
@@ -222,6 +242,9 @@ void Nivel1Oceano::renderizar(QPainter& painter) {
 void Nivel1Oceano::reiniciar() {
     limpiar();
 
+    // Misma semilla: el reinicio reproduce el mismo nivel
+    generador.setSemilla(semilla);
+
     completado = false;
     fallado = false;
     tiempoTranscurrido = 0.0f;
@@ -5,6 +5,7 @@
 #include "submarino.h"
 #include "torpedo.h"
 #include "osciladorarmonico.h"
+#include "capaestatica.h"
 #include <vector>
 
 // Nivel 1: El Naufragio del Lusitania
@@ -14,8 +15,9 @@
 class Nivel1Oceano : public Nivel {
 private:
     // ===== ENTIDADES DEL NIVEL =====
-    std::vector<Submarino*> submarinos;
-    std::vector<Torpedo*> torpedos;
+    // Handles del motor: el motor las borra, aqui solo se consultan
+    std::vector<HandleEntidad> submarinos;
+    std::vector<HandleEntidad> torpedos;
 
     // ===== BARCO LUSITANIA =====
     Vector2D posicionBarco;
@@ -30,6 +32,10 @@ private:
     int submarinosDestruidos;
     int torpedosEvadidos;
 
+    // ===== CAPAS ESTATICAS (se pintan una vez) =====
+    CapaEstatica capaFondo;            // Degradado del oceano (pantalla)
+    CapaEstatica capaBarco;            // Casco y chimeneas, relativos a posicionBarco
+
     // Metodos auxiliares
     void spawnearSubmarino();
     void actualizarSubmarinos(float dt);
@@ -38,7 +44,7 @@ private:
 
 public:
     // ========== CONSTRUCTOR ==========
-    Nivel1Oceano();
+    explicit Nivel1Oceano(uint64_t semillaNivel = 0);
     ~Nivel1Oceano();
 
     // ========== METODOS HEREDADOS ==========
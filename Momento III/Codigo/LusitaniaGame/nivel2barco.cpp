@@ -2,7 +2,6 @@
 #include "gestorsprites.h"
 #include <QColor>
 #include <QPolygonF>
-#include <cstdlib>
 #include <cmath>
 
 #ifndef M_PI
@@ -11,8 +10,8 @@
 
 // ========== CONSTRUCTOR ==========
 
-Nivel2Barco::Nivel2Barco()
-    : Nivel(),
+Nivel2Barco::Nivel2Barco(uint64_t semillaNivel)
+    : Nivel(semillaNivel),
     anguloBarco(0.0f),
     velocidadInclinacion(2.0f),
     tiempoHundimiento(0.0f),
@@ -23,7 +22,11 @@ Nivel2Barco::Nivel2Barco()
     npcsRescatados(0),
     npcsMuertos(0),
     npcsTotales(0),
-    objetivoNPCs(15) {
+    objetivoNPCs(15),
+    spriteFondo(GestorSprites::idSprite("estructura1")),
+    spriteJugador(GestorSprites::idSprite("npc_01")),
+    capaFondo(QRect(0, 0, 800, 600)),
+    fondoConSprite(false) {
 
     anchoNivel = 800;
     altoNivel = 600;
@@ -58,79 +61,78 @@ void Nivel2Barco::inicializar() {
 
     motorFisica->setGravedadActiva(true);
     motorFisica->setGravedad(9.8f);
+    motorFisica->setDimensionesMundo(anchoNivel, altoNivel);
+
+    // Colisiones: jugador, NPCs y objetos interactuan todos entre si
+    // (la matriz por defecto del motor)
 }
 
 void Nivel2Barco::crearNPCs() {
     // Crear 20 NPCs
     for (int i = 0; i < 20; i++) {
-        Vector2D posicion = cuartos[rand() % cuartos.size()];
+        Vector2D posicion = cuartos[generador.entero((int)cuartos.size())];
 
-        posicion.x += (rand() % 60) - 30;
-        posicion.y += (rand() % 30) - 15;
+        posicion.x += generador.entero(60) - 30;
+        posicion.y += generador.entero(30) - 15;
 
         TipoNPC tipo;
-        int tipoRand = rand() % 3;
+        int tipoRand = generador.entero(3);
         if (tipoRand == 0) tipo = TipoNPC::HOMBRE;
         else if (tipoRand == 1) tipo = TipoNPC::MUJER;
         else tipo = TipoNPC::NINO;
 
-        NPC* npc = new NPC(posicion, tipo);
+        NPC* npc = new NPC(posicion, tipo, &generador);
         npc->setDimensiones(36, 50);
         npc->seguirJugador(jugador);
 
-        motorFisica->agregarEntidad(npc);
-        npcs.push_back(npc);
+        npcs.push_back(motorFisica->agregarEntidad(npc));
         npcsTotales++;
     }
 }
 
 void Nivel2Barco::crearObjetos() {
     for (int i = 0; i < 5; i++) {
-        Vector2D pos(180 + i * 100, 280 + (rand() % 40));
+        Vector2D pos(180 + i * 100, 280 + generador.entero(40));
         ObjetoJuego* maleta = new ObjetoJuego(pos, TipoObjeto::MALETA);
-        motorFisica->agregarEntidad(maleta);
-        objetos.push_back(maleta);
+        objetos.push_back(motorFisica->agregarEntidad(maleta));
     }
 
     for (int i = 0; i < 4; i++) {
         Vector2D pos(220 + i * 120, 330);
         ObjetoJuego* silla = new ObjetoJuego(pos, TipoObjeto::SILLA);
-        motorFisica->agregarEntidad(silla);
-        objetos.push_back(silla);
+        objetos.push_back(motorFisica->agregarEntidad(silla));
     }
 }
 
 void Nivel2Barco::spawnearObjetoAleatorio() {
     TipoObjeto tipo;
-    int tipoRand = rand() % 3;
+    int tipoRand = generador.entero(3);
     if (tipoRand == 0) tipo = TipoObjeto::ESCOMBRO_PEQUENO;
     else if (tipoRand == 1) tipo = TipoObjeto::MALETA;
     else tipo = TipoObjeto::ESCOMBRO_GRANDE;
 
-    Vector2D pos(200 + (rand() % 400), 50);
+    Vector2D pos(200 + generador.entero(400), 50);
 
     ObjetoJuego* objeto = new ObjetoJuego(pos, tipo);
-    motorFisica->agregarEntidad(objeto);
-    objetos.push_back(objeto);
+    objetos.push_back(motorFisica->agregarEntidad(objeto));
 }
 
 void Nivel2Barco::respawnearNPC() {
-    Vector2D posicion = cuartos[rand() % cuartos.size()];
-    posicion.x += (rand() % 60) - 30;
-    posicion.y += (rand() % 30) - 15;
+    Vector2D posicion = cuartos[generador.entero((int)cuartos.size())];
+    posicion.x += generador.entero(60) - 30;
+    posicion.y += generador.entero(30) - 15;
 
     TipoNPC tipo;
-    int tipoRand = rand() % 3;
+    int tipoRand = generador.entero(3);
     if (tipoRand == 0) tipo = TipoNPC::HOMBRE;
     else if (tipoRand == 1) tipo = TipoNPC::MUJER;
     else tipo = TipoNPC::NINO;
 
-    NPC* npc = new NPC(posicion, tipo);
+    NPC* npc = new NPC(posicion, tipo, &generador);
     npc->setDimensiones(36, 50);
     npc->seguirJugador(jugador);
 
-    motorFisica->agregarEntidad(npc);
-    npcs.push_back(npc);
+    npcs.push_back(motorFisica->agregarEntidad(npc));
 }
 
 // ========== ACTUALIZACION ==========
@@ -159,6 +161,7 @@ void Nivel2Barco::actualizar(float dt) {
 
     motorFisica->actualizar(dt);
 
+    limitarObjetosACubierta();
     actualizarNPCs(dt);
     actualizarObjetos(dt);
     verificarRescates();
@@ -186,7 +189,8 @@ void Nivel2Barco::actualizarInclinacion(float dt) {
         anguloBarco = 30.0f;
     }
 
-    for (auto* objeto : objetos) {
+    for (const auto& handle : objetos) {
+        ObjetoJuego* objeto = motorFisica->obtenerEntidad<ObjetoJuego>(handle);
         if (objeto && objeto->estaActivo()) {
             objeto->setAnguloBarco(anguloBarco);
         }
@@ -194,31 +198,33 @@ void Nivel2Barco::actualizarInclinacion(float dt) {
 }
 
 void Nivel2Barco::actualizarNPCs(float dt) {
-    static std::map<NPC*, float> tiemposMuerte;
-
+    // Los reemplazos se crean al final: agregarlos a npcs durante el
+    // recorrido invalidaria el iterador
+    int reemplazos = 0;
     auto it = npcs.begin();
 
     while (it != npcs.end()) {
-        NPC* npc = *it;
+        NPC* npc = motorFisica->obtenerEntidad<NPC>(*it);
 
         if (!npc || !npc->estaActivo()) {
+            tiemposMuerte.erase(*it);
             it = npcs.erase(it);
         } else {
             // ===== VERIFICAR SI MURIO =====
             if (!npc->estaConsciente() && npc->getResistencia() <= 0.0f) {
-                if (tiemposMuerte.find(npc) == tiemposMuerte.end()) {
+                if (tiemposMuerte.find(*it) == tiemposMuerte.end()) {
                     // Primera vez que muere
-                    tiemposMuerte[npc] = 0.0f;
+                    tiemposMuerte[*it] = 0.0f;
                     npcsMuertos++;
                     agregarPuntos(-50);
                 }
 
-                tiemposMuerte[npc] += dt;
+                tiemposMuerte[*it] += dt;
 
-                if (tiemposMuerte[npc] >= 5.0f) {
+                if (tiemposMuerte[*it] >= 5.0f) {
                     npc->destruir();
-                    tiemposMuerte.erase(npc);
-                    respawnearNPC();
+                    tiemposMuerte.erase(*it);
+                    reemplazos++;
                 }
             }
 
@@ -231,13 +237,17 @@ void Nivel2Barco::actualizarNPCs(float dt) {
             ++it;
         }
     }
+
+    for (int i = 0; i < reemplazos; i++) {
+        respawnearNPC();
+    }
 }
 
 void Nivel2Barco::actualizarObjetos(float /*dt*/) {
     auto it = objetos.begin();
 
     while (it != objetos.end()) {
-        ObjetoJuego* objeto = *it;
+        ObjetoJuego* objeto = motorFisica->obtenerEntidad<ObjetoJuego>(*it);
 
         if (!objeto || !objeto->estaActivo()) {
             it = objetos.erase(it);
@@ -247,10 +257,52 @@ void Nivel2Barco::actualizarObjetos(float /*dt*/) {
     }
 }
 
+void Nivel2Barco::limitarObjetosACubierta() {
+    // Mismos limites que el jugador. Un objeto que llega a la cubierta o
+    // a una pared pierde esa velocidad; sobre la cubierta queda apoyado
+    // y recien ahi puede dormirse
+    for (const auto& handle : objetos) {
+        ObjetoJuego* objeto = motorFisica->obtenerEntidad<ObjetoJuego>(handle);
+        if (!objeto || !objeto->estaActivo()) continue;
+        if (objeto->estaDormido() || objeto->estaSuspendido()) continue;
+
+        Vector2D pos = objeto->getPosicion();
+        Vector2D vel = objeto->getVelocidad();
+        float ancho = objeto->getAncho();
+        float alto = objeto->getAlto();
+        bool limitado = false;
+
+        if (pos.x < 100) {
+            pos.x = 100;
+            vel.x = 0.0f;
+            limitado = true;
+        } else if (pos.x + ancho > 700) {
+            pos.x = 700 - ancho;
+            vel.x = 0.0f;
+            limitado = true;
+        }
+
+        if (pos.y + alto > 550) {
+            pos.y = 550 - alto;
+            vel.y = 0.0f;
+            limitado = true;
+
+            // Solo la cubierta la sostiene (las paredes no): cuenta para dormirse
+            objeto->marcarApoyo();
+        }
+
+        if (limitado) {
+            objeto->setPosicion(pos);
+            objeto->setVelocidad(vel);
+        }
+    }
+}
+
 void Nivel2Barco::verificarColisionesObjetos() {
     if (!jugador) return;
 
-    for (auto* objeto : objetos) {
+    for (const auto& handle : objetos) {
+        ObjetoJuego* objeto = motorFisica->obtenerEntidad<ObjetoJuego>(handle);
         if (!objeto || !objeto->estaActivo()) continue;
 
         TipoObjeto tipoObj = objeto->getTipo();
@@ -269,7 +321,8 @@ void Nivel2Barco::verificarColisionesObjetos() {
             objeto->setVelocidad(velObjeto * 0.3f);
         }
 
-        for (auto* npc : npcs) {
+        for (const auto& handleNPC : npcs) {
+            NPC* npc = motorFisica->obtenerEntidad<NPC>(handleNPC);
             if (npc && npc->estaActivo() && objeto->colisionaCon(npc)) {
                 npc->caer(danio);
                 objeto->setVelocidad(velObjeto * 0.3f);
@@ -279,7 +332,8 @@ void Nivel2Barco::verificarColisionesObjetos() {
 }
 
 void Nivel2Barco::verificarRescates() {
-    for (auto* npc : npcs) {
+    for (const auto& handle : npcs) {
+        NPC* npc = motorFisica->obtenerEntidad<NPC>(handle);
         if (npc && npc->estaActivo() && npc->getEstado() == EstadoNPC::SIGUIENDO) {
             float distancia = npc->getPosicion().distanciaA(zonaRescate);
 
@@ -315,29 +369,36 @@ void Nivel2Barco::renderizar(QPainter& painter) {
 
     GestorSprites* gestor = GestorSprites::obtenerInstancia();
 
-    QPixmap fondoEstructura = gestor->getSprite("estructura1");
-
-    if (!fondoEstructura.isNull()) {
-        QPixmap fondoEscalado = fondoEstructura.scaled(800, 600,
-                                                       Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        painter.drawPixmap(0, 0, fondoEscalado);
-    } else {
-        painter.fillRect(0, 0, 800, 400, QColor(100, 150, 200));
-        painter.fillRect(0, 400, 800, 200, QColor(0, 50, 100));
+    // El sprite del fondo puede llegar despues (precarga): repintar la capa
+    bool conSprite = gestor->tieneSprite(spriteFondo);
+    if (conSprite != fondoConSprite) {
+        fondoConSprite = conSprite;
+        capaFondo.invalidar();
     }
 
-    // Zona de rescate
-    painter.setBrush(QColor(255, 215, 0, 200));
-    painter.setPen(QPen(QColor(255, 255, 0), 4));
-    painter.drawRect(zonaRescate.x - 80, zonaRescate.y - 30, 160, 60);
+    Vector2D zona = zonaRescate;
+    SpriteId fondo = spriteFondo;
+
+    capaFondo.dibujar(painter, [gestor, fondo, zona](QPainter& p) {
+        if (!gestor->dibujarSprite(p, 0, 0, fondo, 800, 600)) {
+            p.fillRect(0, 0, 800, 400, QColor(100, 150, 200));
+            p.fillRect(0, 400, 800, 200, QColor(0, 50, 100));
+        }
+
+        // Zona de rescate
+        p.setBrush(QColor(255, 215, 0, 200));
+        p.setPen(QPen(QColor(255, 255, 0), 4));
+        p.drawRect(zona.x - 80, zona.y - 30, 160, 60);
 
-    painter.setFont(QFont("Arial", 14, QFont::Bold));
-    painter.setPen(Qt::black);
-    painter.drawText(zonaRescate.x - 70, zonaRescate.y - 5, "ZONA DE");
-    painter.drawText(zonaRescate.x - 70, zonaRescate.y + 15, "RESCATE");
+        p.setFont(QFont("Arial", 14, QFont::Bold));
+        p.setPen(Qt::black);
+        p.drawText(zona.x - 70, zona.y - 5, "ZONA DE");
+        p.drawText(zona.x - 70, zona.y + 15, "RESCATE");
+    });
 
     // Renderizar NPCs con barras de vida
-    for (auto* npc : npcs) {
+    for (const auto& handle : npcs) {
+        NPC* npc = motorFisica->obtenerEntidad<NPC>(handle);
         if (!npc || !npc->estaActivo()) continue;
         npc->renderizar(painter);
     }
@@ -348,17 +409,13 @@ void Nivel2Barco::renderizar(QPainter& painter) {
         float ancho = jugador->getAncho();
         float alto = jugador->getAlto();
 
-        QPixmap spriteJugador = gestor->getSprite("npc_01");
-
-        if (!spriteJugador.isNull()) {
-            QPixmap jugadorEscalado = spriteJugador.scaled(ancho, alto,
-                                                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
-
+        if (gestor->tieneSprite(spriteJugador)) {
             painter.setPen(QPen(Qt::yellow, 4));
             painter.setBrush(Qt::NoBrush);
             painter.drawRect(pos.x - 2, pos.y - 2, ancho + 4, alto + 4);
 
-            painter.drawPixmap(pos.x, pos.y, jugadorEscalado);
+            gestor->dibujarSprite(painter, pos.x, pos.y, spriteJugador, ancho, alto,
+                                  false, Qt::KeepAspectRatio);
         } else {
             painter.setBrush(QColor(0, 200, 0));
             painter.setPen(QPen(Qt::yellow, 3));
@@ -367,7 +424,8 @@ void Nivel2Barco::renderizar(QPainter& painter) {
     }
 
     // Renderizar objetos
-    for (auto* objeto : objetos) {
+    for (const auto& handle : objetos) {
+        ObjetoJuego* objeto = motorFisica->obtenerEntidad<ObjetoJuego>(handle);
         if (objeto && objeto->estaActivo()) {
             objeto->renderizar(painter);
         }
@@ -381,6 +439,9 @@ void Nivel2Barco::renderizar(QPainter& painter) {
 void Nivel2Barco::reiniciar() {
     limpiar();
 
+    // Misma semilla: el reinicio reproduce el mismo nivel
+    generador.setSemilla(semilla);
+
     completado = false;
     fallado = false;
     tiempoTranscurrido = 0.0f;
@@ -394,6 +455,7 @@ void Nivel2Barco::reiniciar() {
 
     npcs.clear();
     objetos.clear();
+    tiemposMuerte.clear();
 
     motorFisica = new MotorFisica();
     camara = new Camara(800, 600);
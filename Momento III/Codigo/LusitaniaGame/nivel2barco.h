@@ -4,7 +4,10 @@
 #include "nivel.h"
 #include "npc.h"
 #include "objetojuego.h"
+#include "atlastexturas.h"
+#include "capaestatica.h"
 #include <vector>
+#include <map>
 
 class Nivel2Barco : public Nivel {
 private:
@@ -17,21 +20,30 @@ private:
     // Zona de rescate
     Vector2D zonaRescate;
 
-    // NPCs
-    std::vector<NPC*> npcs;
+    // NPCs (handles del motor: el motor las borra)
+    std::vector<HandleEntidad> npcs;
     int npcsRescatados;
     int npcsMuertos;
     int npcsTotales;
     int objetivoNPCs;
+    std::map<HandleEntidad, float> tiemposMuerte;  // Segundos desde que murio cada NPC
 
-    // Objetos
-    std::vector<ObjetoJuego*> objetos;
+    // Objetos (handles del motor)
+    std::vector<HandleEntidad> objetos;
     float tiempoSpawnObjeto;
     float intervaloSpawnObjeto;
 
     // Cuartos del barco
     std::vector<Vector2D> cuartos;
 
+    // Sprites (resueltos al construir)
+    SpriteId spriteFondo;
+    SpriteId spriteJugador;
+
+    // Fondo + zona de rescate: no cambian, se pintan una vez
+    CapaEstatica capaFondo;
+    bool fondoConSprite;               // Si la capa se pinto con el sprite o con el reemplazo
+
     void crearNPCs();
     void crearObjetos();
     void spawnearObjetoAleatorio();
@@ -40,11 +52,12 @@ private:
     void actualizarInclinacion(float dt);
     void actualizarNPCs(float dt);
     void actualizarObjetos(float dt);
+    void limitarObjetosACubierta();
     void verificarRescates();
     void verificarColisionesObjetos();
 
 public:
-    Nivel2Barco();
+    explicit Nivel2Barco(uint64_t semillaNivel = 0);
     ~Nivel2Barco();
 
     void inicializar() override;
@@ -1,12 +1,15 @@
 #include "nivel3submarino.h"
 #include "gestorsprites.h"
 #include <QColor>
-#include <cstdlib>
+
+// Con pocos vortices (maximo 5) el lote SIMD exacto es mas rapido que
+// armar el campo: el campo queda para cuando haya muchos
+bool Nivel3Submarino::campoVorticesPorDefecto = false;
 
 // ========== CONSTRUCTOR ==========
 
-Nivel3Submarino::Nivel3Submarino()
-    : Nivel(),
+Nivel3Submarino::Nivel3Submarino(uint64_t semillaNivel)
+    : Nivel(semillaNivel),
     profundidadInicial(3000.0f),
     profundidadObjetivo(0.0f),
     profundidadActual(3000.0f),
@@ -19,16 +22,22 @@ Nivel3Submarino::Nivel3Submarino()
     vorticesEvitados(0),
     vortices(),
     escombros(),
-    objetoActivo(nullptr),
+    campoVortices(32.0f),
+    usarCampoVortices(campoVorticesPorDefecto),
+    idObjetoActivo(-1),
     tiempoObjetoActivo(0.0f),
     duracionEfectoObjeto(0.0f),
     controlsBloqueados(false),
-    tiempoSinOxigeno(0.0f) {
+    tiempoSinOxigeno(0.0f),
+    capaFondo(QRect(0, 0, 800, 600)) {
 
     anchoNivel = 1600;
     altoNivel = 3500;
     tiempoLimite = 0.0f;
 
+    // Franja de la superficie con el grosor del borde
+    capaSuperficie.setArea(QRect(-2, -52, anchoNivel + 4, 104));
+
     camara->setLimites(Vector2D(0, 0), Vector2D(anchoNivel, altoNivel));
     camara->setTieneScroll(true);
 
@@ -37,8 +46,8 @@ Nivel3Submarino::Nivel3Submarino()
 
 Nivel3Submarino::~Nivel3Submarino() {
     vortices.clear();
-    escombros.clear();
-    objetoActivo = nullptr;
+    escombros.limpiar();
+    idObjetoActivo = -1;
 }
 
 // ========== INICIALIZACION ==========
@@ -53,6 +62,7 @@ void Nivel3Submarino::inicializar() {
     motorFisica->agregarEntidad(jugador);
 
     // Spawnear escombros distribuidos
+    escombros.reservar(256);
     for (int i = 0; i < 60; i++) {
         spawnearEscombro();
     }
@@ -64,6 +74,14 @@ void Nivel3Submarino::inicializar() {
 
     motorFisica->setGravedadActiva(true);
     motorFisica->setGravedad(1.2f);
+    motorFisica->setDimensionesMundo(anchoNivel, altoNivel);
+
+    // Colisiones: la caja del vortice es todo su radio, no algo solido.
+    // Con el jugador solo avisa (la atraccion la pone
+    // aplicarFuerzasVortice) y entre vortices no se miran
+    MatrizColision& matriz = motorFisica->getMatrizColision();
+    matriz.ignorarTodo();
+    matriz.setDisparador(TipoEntidad::JUGADOR, TipoEntidad::VORTICE, true);
 }
 
 // ========== ACTUALIZACION ==========
@@ -103,12 +121,15 @@ void Nivel3Submarino::actualizar(float dt) {
         jugador->setOxigeno(oxigenoActual);
     }
 
-    if (objetoActivo) {
+    if (idObjetoActivo >= 0) {
         tiempoObjetoActivo += dt;
 
         if (tiempoObjetoActivo >= duracionEfectoObjeto) {
-            objetoActivo->destruir();
-            objetoActivo = nullptr;
+            int indice = escombros.buscar(idObjetoActivo);
+            if (indice >= 0) {
+                retirarEscombro(indice);
+            }
+            idObjetoActivo = -1;
             controlsBloqueados = false;
             tiempoObjetoActivo = 0.0f;
         }
@@ -155,7 +176,7 @@ void Nivel3Submarino::actualizarVortices(float /*dt*/) {
     auto it = vortices.begin();
 
     while (it != vortices.end()) {
-        Vortice* vortice = *it;
+        Vortice* vortice = motorFisica->obtenerEntidad<Vortice>(*it);
 
         if (!vortice || !vortice->estaActivo()) {
             it = vortices.erase(it);
@@ -167,44 +188,66 @@ void Nivel3Submarino::actualizarVortices(float /*dt*/) {
     }
 }
 
-void Nivel3Submarino::actualizarEscombros(float /*dt*/) {
-    auto it = escombros.begin();
+void Nivel3Submarino::actualizarEscombros(float dt) {
+    // Flotacion de todos los escombros en un solo ciclo
+    escombros.integrar(dt);
 
-    while (it != escombros.end()) {
-        Escombro* escombro = *it;
+    CajaColision cajaJugador;
+    bool jugadorActivo = jugador && jugador->estaActivo();
+    if (jugadorActivo) {
+        cajaJugador = jugador->getColision();
+    }
 
-        if (!escombro || !escombro->estaActivo()) {
-            it = escombros.erase(it);
-            escombrosEvitados++;
-            agregarPuntos(10);
-        } else {
-            // ===== INTERACCION CON JUGADOR =====
-            if (jugador && escombro->colisionaCon(jugador)) {
-                aplicarEfectoEscombro(escombro);
+    size_t i = 0;
+    while (i < escombros.getCantidad()) {
+        // Al retirar, el ultimo ocupa la posicion i: no avanzar
+        if (escombros.estaFueraDeLimites(i)) {
+            retirarEscombro(i);
+            continue;
+        }
+
+        // ===== INTERACCION CON JUGADOR =====
+        if (jugadorActivo && escombros.colisionaCon(i, cajaJugador)) {
+            if (aplicarEfectoEscombro(i)) {
+                retirarEscombro(i);
+                continue;
             }
-            ++it;
         }
+
+        i++;
     }
 }
 
-void Nivel3Submarino::aplicarEfectoEscombro(Escombro* escombro) {
-    if (!jugador || !escombro) return;
+void Nivel3Submarino::retirarEscombro(size_t indice) {
+    if (escombros.getId(indice) == idObjetoActivo) {
+        idObjetoActivo = -1;
+        controlsBloqueados = false;
+        tiempoObjetoActivo = 0.0f;
+    }
+
+    escombros.eliminar(indice);
+    escombrosEvitados++;
+    agregarPuntos(10);
+}
 
-    if (objetoActivo && objetoActivo != escombro) return;
+bool Nivel3Submarino::aplicarEfectoEscombro(size_t indice) {
+    if (!jugador) return false;
 
-    switch (escombro->getTipo()) {
+    int id = escombros.getId(indice);
+    if (idObjetoActivo >= 0 && idObjetoActivo != id) return false;
+
+    switch (escombros.getTipo(indice)) {
     case TipoEscombro::SALVAVIDAS: {
         float oxigenoActual = jugador->getOxigeno();
         jugador->setOxigeno(oxigenoActual + 30.0f);
         agregarPuntos(50);
-        escombro->destruir();
         tiempoSinOxigeno = 0.0f;  // Reset contador de daño
-        break;
+        return true;
     }
 
     case TipoEscombro::MADERA: {
-        if (!objetoActivo) {
-            objetoActivo = escombro;
+        if (idObjetoActivo < 0) {
+            idObjetoActivo = id;
             duracionEfectoObjeto = 3.0f;
             tiempoObjetoActivo = 0.0f;
             controlsBloqueados = true;
@@ -216,8 +259,8 @@ void Nivel3Submarino::aplicarEfectoEscombro(Escombro* escombro) {
     }
 
     case TipoEscombro::METAL_PESADO: {
-        if (!objetoActivo) {
-            objetoActivo = escombro;
+        if (idObjetoActivo < 0) {
+            idObjetoActivo = id;
             duracionEfectoObjeto = 2.0f;
             tiempoObjetoActivo = 0.0f;
             controlsBloqueados = true;
@@ -233,6 +276,8 @@ void Nivel3Submarino::aplicarEfectoEscombro(Escombro* escombro) {
         break;
     }
     }
+
+    return false;
 }
 
 void Nivel3Submarino::aplicarFuerzasVortice(float dt) {
@@ -240,8 +285,11 @@ void Nivel3Submarino::aplicarFuerzasVortice(float dt) {
 
     bool bloqueadoPorVortice = false;
     Vector2D fuerzaTotalVortices(0, 0);
+    campoVortices.limpiar();
+
+    for (const auto& handle : vortices) {
+        Vortice* vortice = motorFisica->obtenerEntidad<Vortice>(handle);
 
-    for (auto* vortice : vortices) {
         if (vortice && vortice->estaActivo()) {
             Vector2D posJugador = jugador->getPosicion();
             Vector2D centroVortice = vortice->getCentro();
@@ -290,15 +338,21 @@ void Nivel3Submarino::aplicarFuerzasVortice(float dt) {
                 fuerzaTotalVortices += fuerza;
             }
 
-            // Aplicar a escombros
-            for (auto* escombro : escombros) {
-                if (escombro && escombro->estaActivo()) {
-                    vortice->aplicarFuerzaA(escombro);
-                }
+            // Aplicar a escombros (misma fuerza que Vortice::aplicarFuerzaA)
+            if (usarCampoVortices) {
+                campoVortices.agregarVortice(vortice->getPosicion(), rangoAtraccion, 500.0f);
+            } else {
+                escombros.aplicarAtraccion(vortice->getPosicion(), rangoAtraccion, 500.0f, dt);
             }
         }
     }
 
+    // Escombros: todos los vortices en una sola lectura por escombro
+    if (usarCampoVortices && !campoVortices.estaVacio()) {
+        campoVortices.construir();
+        escombros.aplicarCampo(campoVortices, dt);
+    }
+
     // ===== APLICAR FUERZA ACUMULADA AL JUGADOR =====
     if (fuerzaTotalVortices.magnitud() > 0.01f) {
         Vector2D velActual = jugador->getVelocidad();
@@ -306,44 +360,40 @@ void Nivel3Submarino::aplicarFuerzasVortice(float dt) {
     }
 
     // ===== BLOQUEAR CONTROLES SI ESTA ATRAPADO EN EL CENTRO =====
-    if (bloqueadoPorVortice && !objetoActivo) {
+    if (bloqueadoPorVortice && idObjetoActivo < 0) {
         controlsBloqueados = true;
-    } else if (!objetoActivo) {
+    } else if (idObjetoActivo < 0) {
         controlsBloqueados = false;
     }
 }
 
 void Nivel3Submarino::spawnearVortice() {
-    float x = 200.0f + (rand() % 1200);
-    float y = profundidadActual + (rand() % 1000) - 500;
+    float x = 200.0f + generador.entero(1200);
+    float y = profundidadActual + generador.entero(1000) - 500;
 
     if (y < 100) y = 100;
     if (y > altoNivel - 100) y = altoNivel - 100;
 
-    Vortice* vortice = new Vortice(Vector2D(x, y), 120.0f, 15.0f);
+    Vortice* vortice = new Vortice(Vector2D(x, y), 120.0f, 15.0f, &generador);
 
-    motorFisica->agregarEntidad(vortice);
-    vortices.push_back(vortice);
+    vortices.push_back(motorFisica->agregarEntidad(vortice));
 }
 
 void Nivel3Submarino::spawnearEscombro() {
     TipoEscombro tipo;
-    int tipoRand = rand() % 10;
+    int tipoRand = generador.entero(10);
 
     if (tipoRand < 4) tipo = TipoEscombro::MADERA;
     else if (tipoRand < 7) tipo = TipoEscombro::METAL_PESADO;
     else if (tipoRand < 9) tipo = TipoEscombro::SALVAVIDAS;
     else tipo = TipoEscombro::NEUTRO;
 
-    float x = 200.0f + (rand() % 1200);
+    float x = 200.0f + generador.entero(1200);
     float y = profundidadActual - 400.0f;
 
     if (y < 50) y = 50;
 
-    Escombro* escombro = new Escombro(Vector2D(x, y), tipo);
-
-    motorFisica->agregarEntidad(escombro);
-    escombros.push_back(escombro);
+    escombros.agregar(Vector2D(x, y), tipo);
 }
 
 // ========== RENDERIZADO ==========
@@ -353,34 +403,40 @@ void Nivel3Submarino::renderizar(QPainter& painter) {
 
     painter.save();
 
-    // Fondo mas claro
-    QLinearGradient gradiente(0, 0, 0, 600);
-    gradiente.setColorAt(0, QColor(20, 60, 100));
-    gradiente.setColorAt(0.5, QColor(10, 40, 80));
-    gradiente.setColorAt(1, QColor(5, 20, 50));
-    painter.fillRect(0, 0, 800, 600, gradiente);
+    // Fondo mas claro (el degradado se arma una sola vez)
+    capaFondo.dibujar(painter, [](QPainter& p) {
+        QLinearGradient gradiente(0, 0, 0, 600);
+        gradiente.setColorAt(0, QColor(20, 60, 100));
+        gradiente.setColorAt(0.5, QColor(10, 40, 80));
+        gradiente.setColorAt(1, QColor(5, 20, 50));
+        p.fillRect(0, 0, 800, 600, gradiente);
+    });
 
     Vector2D offsetCamara = camara->getPosicion();
     painter.translate(-offsetCamara.x, -offsetCamara.y);
 
-    // Superficie
-    painter.setBrush(QColor(100, 200, 255, 180));
-    painter.setPen(QPen(QColor(255, 255, 100), 4));
-    painter.drawRect(0, -50, anchoNivel, 100);
-
-    painter.setPen(Qt::white);
-    painter.setFont(QFont("Arial", 24, QFont::Bold));
-    painter.drawText(600, 20, "¡SUPERFICIE!");
-
-    // Renderizar escombros
-    for (auto* escombro : escombros) {
-        if (!escombro || !escombro->estaActivo()) continue;
-        escombro->renderizar(painter);
+    // Superficie (solo se copia cuando la camara llega arriba)
+    if (offsetCamara.y < 52) {
+        int ancho = anchoNivel;
+        capaSuperficie.dibujar(painter, [ancho](QPainter& p) {
+            p.setBrush(QColor(100, 200, 255, 180));
+            p.setPen(QPen(QColor(255, 255, 100), 4));
+            p.drawRect(0, -50, ancho, 100);
+
+            p.setPen(Qt::white);
+            p.setFont(QFont("Arial", 24, QFont::Bold));
+            p.drawText(600, 20, "¡SUPERFICIE!");
+        });
     }
 
+    // Renderizar escombros (solo los que estan en pantalla)
+    escombros.renderizar(painter, camara->getRectVisible());
+
     // Renderizar vortices
-    for (auto* vortice : vortices) {
+    for (const auto& handle : vortices) {
+        Vortice* vortice = motorFisica->obtenerEntidad<Vortice>(handle);
         if (!vortice || !vortice->estaActivo()) continue;
+        if (!camara->estaVisible(vortice->getLimitesVisuales())) continue;
 
         Vector2D pos = vortice->getCentro();
         float radio = vortice->getRadio();
@@ -434,6 +490,9 @@ void Nivel3Submarino::renderizar(QPainter& painter) {
 void Nivel3Submarino::reiniciar() {
     limpiar();
 
+    // Misma semilla: el reinicio reproduce el mismo nivel
+    generador.setSemilla(semilla);
+
     completado = false;
     fallado = false;
     tiempoTranscurrido = 0.0f;
@@ -443,14 +502,14 @@ void Nivel3Submarino::reiniciar() {
     vorticesEvitados = 0;
     tiempoSpawnVortice = 0.0f;
     tiempoSpawnEscombro = 0.0f;
-    objetoActivo = nullptr;
+    idObjetoActivo = -1;
     tiempoObjetoActivo = 0.0f;
     duracionEfectoObjeto = 0.0f;
     controlsBloqueados = false;
     tiempoSinOxigeno = 0.0f;
 
     vortices.clear();
-    escombros.clear();
+    escombros.limpiar();
 
     motorFisica = new MotorFisica();
     camara = new Camara(800, 600);
@@ -472,6 +531,60 @@ bool Nivel3Submarino::verificarDerrota() {
 void Nivel3Submarino::manejarInput(int /*tecla*/, bool /*presionada*/) {
 }
 
+void Nivel3Submarino::aplicarEntrada(const EntradaJugador& entrada, float dt) {
+    (void)dt;
+    if (!jugador) return;
+
+    // No permitir movimiento si esta muriendo
+    if (jugador->estaEnAnimacionMuerte()) return;
+
+    // Controles bloqueados por vortice u objeto - NO permitir input
+    if (controlsBloqueados) return;
+
+    // Bajo el agua se suma a la velocidad (para que los vortices afecten)
+    if (entrada.direccion.magnitud() > 0.0f) {
+        Vector2D direccionNorm = entrada.direccion.normalizado();
+        Vector2D velocidadDeseada = direccionNorm * jugador->getVelocidadBase();
+
+        Vector2D velActual = jugador->getVelocidad();
+        Vector2D nuevaVel = velActual * 0.85f + velocidadDeseada * 0.15f;  // Blend suave
+        jugador->setVelocidad(nuevaVel);
+    } else {
+        // Si no hay input, aplicar friccion
+        Vector2D velActual = jugador->getVelocidad();
+        jugador->setVelocidad(velActual * 0.92f);
+    }
+
+    if (entrada.habilidad) {
+        jugador->usarHabilidad();
+    }
+}
+
+void Nivel3Submarino::setCampoVorticesPorDefecto(bool usar) {
+    campoVorticesPorDefecto = usar;
+}
+
 bool Nivel3Submarino::estanControlsBloqueados() const {
     return controlsBloqueados;
 }
+
+// ========== INTERPOLACION ==========
+
+void Nivel3Submarino::guardarEstadoAnterior() {
+    Nivel::guardarEstadoAnterior();
+    escombros.guardarPosicionesAnteriores();
+}
+
+void Nivel3Submarino::aplicarInterpolacion(float alpha) {
+    if (interpolando) return;
+
+    escombros.interpolar(alpha);
+    Nivel::aplicarInterpolacion(alpha);
+}
+
+void Nivel3Submarino::restaurarEstado() {
+    if (!interpolando) return;
+
+    escombros.restaurar();
+    Nivel::restaurarEstado();
+}
@@ -3,7 +3,8 @@
 
 #include "nivel.h"
 #include "vortice.h"
-#include "escombro.h"
+#include "sistemaescombros.h"
+#include "capaestatica.h"
 #include <vector>
 
 // Nivel 3: Escape del Fondo Marino
@@ -29,27 +30,38 @@ private:
     int vorticesEvitados;
 
     // ===== ENTIDADES DEL NIVEL =====
-    std::vector<Vortice*> vortices;
-    std::vector<Escombro*> escombros;
+    std::vector<HandleEntidad> vortices;    // Handles del motor (el motor las borra)
+    SistemaEscombros escombros;         // Fuera del motor: arreglos contiguos
+
+    // Atraccion de los vortices sobre los escombros: campo en grilla
+    // (bilineal) o el calculo exacto por par vortice-escombro
+    CampoVortices campoVortices;
+    bool usarCampoVortices;
+    static bool campoVorticesPorDefecto;
 
     // Control de objetos activos
-    Escombro* objetoActivo;
+    int idObjetoActivo;                 // Id del escombro que arrastra al jugador (-1 = ninguno)
     float tiempoObjetoActivo;
     float duracionEfectoObjeto;
     bool controlsBloqueados;
     float tiempoSinOxigeno;
 
+    // ===== CAPAS ESTATICAS (se pintan una vez) =====
+    CapaEstatica capaFondo;             // Degradado (pantalla)
+    CapaEstatica capaSuperficie;        // Franja y texto de la superficie (mundo)
+
     // Metodos auxiliares
     void spawnearVortice();
     void spawnearEscombro();
     void actualizarVortices(float dt);
     void actualizarEscombros(float dt);
     void aplicarFuerzasVortice(float dt);
-    void aplicarEfectoEscombro(Escombro* escombro);
+    bool aplicarEfectoEscombro(size_t indice);     // true si el escombro se consumio
+    void retirarEscombro(size_t indice);
 
 public:
     // ========== CONSTRUCTOR ==========
-    Nivel3Submarino();
+    explicit Nivel3Submarino(uint64_t semillaNivel = 0);
     ~Nivel3Submarino();
 
     // ========== METODOS HEREDADOS ==========
@@ -63,6 +75,20 @@ public:
     bool estanControlsBloqueados() const;
 
     void manejarInput(int tecla, bool presionada) override;
+    void aplicarEntrada(const EntradaJugador& entrada, float dt) override;
+
+    // ===== CAMPO DE VORTICES =====
+    // El jugador siempre usa el calculo exacto (su resistencia y el
+    // bloqueo dependen de cada vortice); esto es solo para escombros
+    void setUsarCampoVortices(bool usar) { usarCampoVortices = usar; }
+    bool getUsarCampoVortices() const { return usarCampoVortices; }
+    // Para los niveles que se creen despues (headless --vortices)
+    static void setCampoVorticesPorDefecto(bool usar);
+
+    // Los escombros no estan en el motor: se interpolan aparte
+    void guardarEstadoAnterior() override;
+    void aplicarInterpolacion(float alpha) override;
+    void restaurarEstado() override;
 };
 
 #endif // NIVEL3SUBMARINO_H
@@ -1,7 +1,6 @@
 #include "npc.h"
 #include "gestorsprites.h"
 #include <cmath>
-#include <cstdlib>
 #include <QColor>
 
 #ifndef M_PI
@@ -17,6 +16,7 @@ NPC::NPC()
     velocidadBase(80.0f),
     direccionPanico(1, 0),
     tiempoDireccion(0.0f),
+    aleatorio(&GeneradorAleatorio::porDefecto()),
     jugador(nullptr),
     rangoSeguimiento(100.0f),
     resistencia(100.0f),
@@ -27,15 +27,20 @@ NPC::NPC()
 
     setDimensiones(24, 40);
     configurarSegunTipo();
+
+    // Seleccionar sprite segun tipo (rotando entre las 8 variaciones)
+    int variacion = ((int)tipoNPC % 8) + 1;
+    sprite = GestorSprites::idSprite(QString("npc_%1").arg(variacion, 2, 10, QChar('0')));
 }
 
-NPC::NPC(const Vector2D& pos, TipoNPC tipo)
+NPC::NPC(const Vector2D& pos, TipoNPC tipo, GeneradorAleatorio* gen)
     : Entidad(pos, TipoEntidad::NPC),
     tipoNPC(tipo),
     estadoNPC(EstadoNPC::PANICO),
     velocidadBase(80.0f),
     direccionPanico(1, 0),
     tiempoDireccion(0.0f),
+    aleatorio(gen ? gen : &GeneradorAleatorio::porDefecto()),
     jugador(nullptr),
     rangoSeguimiento(100.0f),
     resistencia(100.0f),
@@ -46,6 +51,10 @@ NPC::NPC(const Vector2D& pos, TipoNPC tipo)
 
     setDimensiones(24, 40);
     configurarSegunTipo();
+
+    // Seleccionar sprite segun tipo (rotando entre las 8 variaciones)
+    int variacion = ((int)tipoNPC % 8) + 1;
+    sprite = GestorSprites::idSprite(QString("npc_%1").arg(variacion, 2, 10, QChar('0')));
 }
 
 NPC::~NPC() {
@@ -80,7 +89,7 @@ void NPC::configurarSegunTipo() {
     }
 
     // Elegir direccion inicial aleatoria
-    float angulo = (rand() % 360) * M_PI / 180.0f;
+    float angulo = aleatorio->entero(360) * M_PI / 180.0f;
     direccionPanico = Vector2D(std::cos(angulo), std::sin(angulo));
 }
 
@@ -151,9 +160,9 @@ void NPC::actualizarMovimiento(float dt) {
 
     if (tiempoDireccion <= 0.0f) {
         // Cambiar direccion aleatoriamente
-        float angulo = (rand() % 360) * M_PI / 180.0f;
+        float angulo = aleatorio->entero(360) * M_PI / 180.0f;
         direccionPanico = Vector2D(std::cos(angulo), std::sin(angulo));
-        tiempoDireccion = 1.0f + (rand() % 200) / 100.0f; // 1-3 segundos
+        tiempoDireccion = 1.0f + aleatorio->entero(200) / 100.0f; // 1-3 segundos
     }
 
     // Movimiento con la direccion de panico
@@ -174,16 +183,6 @@ void NPC::renderizar(QPainter& painter) {
 
     painter.save();
 
-    // Obtener sprite segun tipo
-    GestorSprites* gestor = GestorSprites::obtenerInstancia();
-    QString nombreSprite;
-
-    // Seleccionar sprite segun tipo (rotando entre las 8 variaciones)
-    int variacion = ((int)tipoNPC % 8) + 1;
-    nombreSprite = QString("npc_%1").arg(variacion, 2, 10, QChar('0'));
-
-    QPixmap spriteNPC = gestor->getSprite(nombreSprite);
-
     // Si esta inconsciente, dibujar acostado
     if (!consciente || estadoNPC == EstadoNPC::CAIDO) {
         painter.setBrush(QColor(100, 100, 100));
@@ -200,13 +199,12 @@ void NPC::renderizar(QPainter& painter) {
     }
 
     // Dibujar NPC de pie
-    if (!spriteNPC.isNull()) {
-        // Usar sprite
-        QPixmap npcEscalado = spriteNPC.scaled(ancho, alto,
-                                               Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    // La region se busca aqui y no en el NPC: la simulacion puede correr
+    // en hilos sin GUI y la instancia de GestorSprites es del hilo de render
+    bool dibujado = GestorSprites::obtenerInstancia()->dibujarSprite(
+        painter, posicion.x, posicion.y, sprite, ancho, alto, false, Qt::KeepAspectRatio);
 
-        painter.drawPixmap(posicion.x, posicion.y, npcEscalado);
-    } else {
+    if (!dibujado) {
         // Fallback: dibujo manual original
         QColor colorBase;
         switch (tipoNPC) {
@@ -261,6 +259,12 @@ void NPC::renderizar(QPainter& painter) {
     painter.restore();
 }
 
+QRectF NPC::getLimitesVisuales() const {
+    // Barra de resistencia 15 px arriba; caido, la elipse mide 1.5 del
+    // ancho y el "Zzz" queda a la derecha
+    return QRectF(posicion.x, posicion.y - 15, ancho * 1.5f + 35, alto + 15);
+}
+
 void NPC::onColision(Entidad* otra) {
     if (!otra) return;
 
@@ -288,7 +292,7 @@ void NPC::entrarEnPanico() {
     estadoNPC = EstadoNPC::PANICO;
 
     // Elegir nueva direccion aleatoria
-    float angulo = (rand() % 360) * M_PI / 180.0f;
+    float angulo = aleatorio->entero(360) * M_PI / 180.0f;
     direccionPanico = Vector2D(std::cos(angulo), std::sin(angulo));
     tiempoDireccion = 2.0f;
 }
@@ -3,6 +3,8 @@
 
 #include "entidad.h"
 #include "tipos.h"
+#include "generadoraleatorio.h"
+#include "atlastexturas.h"
 #include <QPainter>
 
 // NPC - Non-Player Character (Pasajeros del Lusitania)
@@ -17,6 +19,7 @@ private:
     float velocidadBase;          // Velocidad segun tipo
     Vector2D direccionPanico;     // Direccion aleatoria en panico
     float tiempoDireccion;        // Tiempo hasta cambiar direccion
+    GeneradorAleatorio* aleatorio; // Generador del nivel (no es dueño)
 
     // Seguimiento
     Entidad* jugador;             // Referencia al jugador
@@ -30,6 +33,7 @@ private:
     // Animacion
     float frameTiempo;
     int frameActual;
+    SpriteId sprite;              // Resuelto al construir; en el render solo se indexa
 
     void configurarSegunTipo();
     void actualizarMovimiento(float dt);
@@ -37,13 +41,14 @@ private:
 public:
     // ========== CONSTRUCTORES ==========
     NPC();
-    NPC(const Vector2D& pos, TipoNPC tipo);
+    NPC(const Vector2D& pos, TipoNPC tipo, GeneradorAleatorio* gen = nullptr);
     ~NPC();
 
     // ========== METODOS HEREDADOS ==========
     void actualizar(float dt) override;
     void renderizar(QPainter& painter) override;
     void onColision(Entidad* otra) override;
+    QRectF getLimitesVisuales() const override;
 
     // ========== COMPORTAMIENTO ==========
     void entrarEnPanico();
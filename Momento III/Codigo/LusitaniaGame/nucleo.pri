@@ -0,0 +1,109 @@
+# Nucleo del juego: motor, niveles, entidades, fisica e IA
+# Compartido por el juego (LusitaniaGame.pro) y las herramientas
+# sin ventana (headless/). No incluye widgets ni sonido.
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+# qmake CONFIG+=avx: los nucleos SIMD (FisicaVortice::aplicarCampoLote)
+# procesan 8 floats por instruccion en vez de 4 (SSE2). El binario ya
+# no corre en procesadores sin AVX.
+avx {
+    gcc: QMAKE_CXXFLAGS += -mavx
+    msvc: QMAKE_CXXFLAGS += /arch:AVX
+}
+
+SOURCES += \
+    $$PWD/agenteia.cpp \
+    $$PWD/archivoassets.cpp \
+    $$PWD/atlastexturas.cpp \
+    $$PWD/camara.cpp \
+    $$PWD/campovortices.cpp \
+    $$PWD/capaestatica.cpp \
+    $$PWD/componentefisica.cpp \
+    $$PWD/configuracionsprites.cpp \
+    $$PWD/datosia.cpp \
+    $$PWD/ejecutorparalelo.cpp \
+    $$PWD/enemigo.cpp \
+    $$PWD/entidad.cpp \
+    $$PWD/escombro.cpp \
+    $$PWD/fisicaflotacion.cpp \
+    $$PWD/fisicavortice.cpp \
+    $$PWD/generadoraleatorio.cpp \
+    $$PWD/gestorsprites.cpp \
+    $$PWD/gridespacial.cpp \
+    $$PWD/jugador.cpp \
+    $$PWD/lotedibujo.cpp \
+    $$PWD/matrizcolision.cpp \
+    $$PWD/motorfisica.cpp \
+    $$PWD/motorjuego.cpp \
+    $$PWD/movimientocircular.cpp \
+    $$PWD/nivel.cpp \
+    $$PWD/nivel1oceano.cpp \
+    $$PWD/nivel2barco.cpp \
+    $$PWD/nivel3submarino.cpp \
+    $$PWD/npc.cpp \
+    $$PWD/objetojuego.cpp \
+    $$PWD/osciladorarmonico.cpp \
+    $$PWD/perfilador.cpp \
+    $$PWD/registroentidades.cpp \
+    $$PWD/simuladorheadless.cpp \
+    $$PWD/sistemaaccion.cpp \
+    $$PWD/sistemaaprendizaje.cpp \
+    $$PWD/sistemaescombros.cpp \
+    $$PWD/sistemapercepcion.cpp \
+    $$PWD/sistemarazonamiento.cpp \
+    $$PWD/submarino.cpp \
+    $$PWD/torpedo.cpp \
+    $$PWD/trayectoriaparabolica.cpp \
+    $$PWD/vector2d.cpp \
+    $$PWD/vortice.cpp
+
+HEADERS += \
+    $$PWD/agenteia.h \
+    $$PWD/archivoassets.h \
+    $$PWD/atlastexturas.h \
+    $$PWD/buffertriple.h \
+    $$PWD/camara.h \
+    $$PWD/campovortices.h \
+    $$PWD/capaestatica.h \
+    $$PWD/componentefisica.h \
+    $$PWD/configuracionsprites.h \
+    $$PWD/datosia.h \
+    $$PWD/ejecutorparalelo.h \
+    $$PWD/enemigo.h \
+    $$PWD/entidad.h \
+    $$PWD/escombro.h \
+    $$PWD/fisicaflotacion.h \
+    $$PWD/fisicavortice.h \
+    $$PWD/generadoraleatorio.h \
+    $$PWD/gestorsprites.h \
+    $$PWD/gridespacial.h \
+    $$PWD/jugador.h \
+    $$PWD/lotedibujo.h \
+    $$PWD/matrizcolision.h \
+    $$PWD/motorfisica.h \
+    $$PWD/motorjuego.h \
+    $$PWD/movimientocircular.h \
+    $$PWD/nivel.h \
+    $$PWD/nivel1oceano.h \
+    $$PWD/nivel2barco.h \
+    $$PWD/nivel3submarino.h \
+    $$PWD/npc.h \
+    $$PWD/objetojuego.h \
+    $$PWD/osciladorarmonico.h \
+    $$PWD/perfilador.h \
+    $$PWD/poolobjetos.h \
+    $$PWD/registroentidades.h \
+    $$PWD/simuladorheadless.h \
+    $$PWD/sistemaaccion.h \
+    $$PWD/sistemaaprendizaje.h \
+    $$PWD/sistemaescombros.h \
+    $$PWD/sistemapercepcion.h \
+    $$PWD/sistemarazonamiento.h \
+    $$PWD/submarino.h \
+    $$PWD/tipos.h \
+    $$PWD/torpedo.h \
+    $$PWD/trayectoriaparabolica.h \
+    $$PWD/vector2d.h \
+    $$PWD/vortice.h
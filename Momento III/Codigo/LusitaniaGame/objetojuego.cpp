@@ -24,6 +24,7 @@ ObjetoJuego::ObjetoJuego()
 
     setDimensiones(32, 24);
     configurarSegunTipo();
+    setPuedeDormir(!suspendido);        // La lampara oscila siempre
 }
 
 ObjetoJuego::ObjetoJuego(const Vector2D& pos, TipoObjeto tipo)
@@ -42,6 +43,7 @@ ObjetoJuego::ObjetoJuego(const Vector2D& pos, TipoObjeto tipo)
 
     setDimensiones(32, 24);
     configurarSegunTipo();
+    setPuedeDormir(!suspendido);        // La lampara oscila siempre
 }
 
 ObjetoJuego::~ObjetoJuego() {
@@ -116,7 +118,7 @@ void ObjetoJuego::actualizar(float dt) {
 
     if (suspendido && movCircular) {
         // Lampara colgante - usar MCU
-        movCircular->aplicar(this);
+        movCircular->aplicar(this, dt);
 
         // Aumentar velocidad angular con la inclinacion
         float velocidadAngular = 0.5f + (anguloBarco / 50.0f);
@@ -271,6 +273,17 @@ void ObjetoJuego::renderizar(QPainter& painter) {
     }
 }
 
+QRectF ObjetoJuego::getLimitesVisuales() const {
+    float centroX = posicion.x + ancho / 2.0f;
+    float centroY = posicion.y + alto / 2.0f;
+
+    // Asa de la maleta y brillo de la lampara, y la flecha de velocidad
+    // (20 px desde el centro)
+    return QRectF(posicion.x, posicion.y, ancho, alto)
+        .united(QRectF(centroX - 20, posicion.y - 5, 40, 55))
+        .united(QRectF(centroX - 20, centroY - 20, 40, 40));
+}
+
 void ObjetoJuego::onColision(Entidad* otra) {
     if (!otra) return;
 
@@ -297,6 +310,13 @@ void ObjetoJuego::onColision(Entidad* otra) {
 // ========== METODOS ESPECIFICOS ==========
 
 void ObjetoJuego::setAnguloBarco(float angulo) {
+    if (estaDormido()) {
+        // Quieto contra la cubierta: solo vuelve a deslizar si el barco
+        // se inclino bastante desde que se durmio
+        if (std::abs(angulo - anguloBarco) <= DELTA_ANGULO_DESPERTAR) return;
+        despertar();
+    }
+
     anguloBarco = angulo;
 
     // Actualizar velocidad angular de lampara si es suspendida
@@ -310,6 +330,7 @@ void ObjetoJuego::colgar(const Vector2D& anclaje) {
     suspendido = true;
     enSuelo = false;
     puntoAnclaje = anclaje;
+    setPuedeDormir(false);
 
     // Crear fisica MCU con la longitud de cuerda especificada
     if (!movCircular) {
@@ -325,6 +346,7 @@ void ObjetoJuego::colgar(const Vector2D& anclaje) {
 void ObjetoJuego::soltar() {
     suspendido = false;
     enSuelo = false; // Esta cayendo
+    setPuedeDormir(true);
 
     // Eliminar fisica MCU
     if (movCircular) {
@@ -17,7 +17,7 @@ private:
     bool suspendido;
 
     // Movimiento por inclinacion
-    float anguloBarco;
+    float anguloBarco;                  // Dormido: el que habia al dormirse
     float aceleracionDeslizamiento;
 
     // Fisica de lampara (MCU)
@@ -28,6 +28,9 @@ private:
     // Daño
     float danioContacto;
 
+    // Grados que tiene que cambiar la inclinacion para despertarlo
+    static constexpr float DELTA_ANGULO_DESPERTAR = 3.0f;
+
     void configurarSegunTipo();
     void actualizarPorInclinacion(float dt);
 
@@ -41,6 +44,7 @@ public:
     void actualizar(float dt) override;
     void renderizar(QPainter& painter) override;
     void onColision(Entidad* otra) override;
+    QRectF getLimitesVisuales() const override;
 
     // ========== METODOS ESPECIFICOS ==========
     void setAnguloBarco(float angulo);
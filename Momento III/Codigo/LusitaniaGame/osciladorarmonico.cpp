@@ -8,7 +8,8 @@
 // ========== CONSTRUCTORES ==========
 
 OsciladorArmonico::OsciladorArmonico()
-    : amplitud(15.0f),                    // 15 pixeles de altura
+    : ComponenteFisica(TipoFisica::OSCILADOR),
+    amplitud(15.0f),                    // 15 pixeles de altura
     frecuencia(2.0f * M_PI / 3.0f),     // Periodo de 3 segundos
     fase(0.0f),                          // Sin desplazamiento inicial
     posicionBase(0.0f),                  // Se configurara despues
@@ -17,7 +18,8 @@ OsciladorArmonico::OsciladorArmonico()
 }
 
 OsciladorArmonico::OsciladorArmonico(float A, float freq, float phi)
-    : amplitud(A), frecuencia(freq), fase(phi),
+    : ComponenteFisica(TipoFisica::OSCILADOR),
+    amplitud(A), frecuencia(freq), fase(phi),
     posicionBase(0.0f), tiempoTotal(0.0f) {
     // Constructor con parametros personalizados
 }
@@ -54,9 +56,9 @@ Vector2D OsciladorArmonico::calcular(Entidad* e, float dt) {
     return Vector2D(posicionActual.x, posicionBase + offsetY);
 }
 
-void OsciladorArmonico::aplicar(Entidad* e) {
-    // Incrementar tiempo (asumiendo ~60 FPS)
-    tiempoTotal += 0.016f;
+void OsciladorArmonico::aplicar(Entidad* e, float dt) {
+    // Incrementar tiempo
+    tiempoTotal += dt;
 
     // Calcular desplazamiento
     float offsetY = calcularDesplazamiento(tiempoTotal);
@@ -8,7 +8,7 @@
 // Movimiento Armonico Simple (MAS)
 // Usado para: Oscilación del Lusitania en las olas (Nivel 1)
 // Ecuación: y(t) = A × sin(ωt + φ)
-class OsciladorArmonico : public ComponenteFisica {
+class OsciladorArmonico final : public ComponenteFisica {
 private:
     float amplitud;           // A - Altura de oscilacion (15 pixeles)
     float frecuencia;         // ω (omega) - Velocidad de oscilación (2π/3)
@@ -24,7 +24,7 @@ public:
 
     // ========== METODOS HEREDADOS ==========
     Vector2D calcular(Entidad* e, float dt) override;
-    void aplicar(Entidad* e) override;
+    void aplicar(Entidad* e, float dt) override;
 
     // Calcula el desplazamiento en un momento dado
     float calcularDesplazamiento(float t) const;
@@ -5,7 +5,8 @@
 #include <QHBoxLayout>
 
 PantallaDerrota::PantallaDerrota(QWidget *parent)
-    : QWidget(parent), puntuacion(0), nivel(1) {
+    : QWidget(parent), puntuacion(0), nivel(1),
+    spriteFondo(GestorSprites::idSprite("menu_fondo")) {
 
     setFixedSize(800, 600);
     configurarUI();
@@ -149,13 +150,7 @@ void PantallaDerrota::paintEvent(QPaintEvent* event) {
 
     // Fondo con imagen
     GestorSprites* gestor = GestorSprites::obtenerInstancia();
-    QPixmap fondoMenu = gestor->getSprite("menu_fondo");
-
-    if (!fondoMenu.isNull()) {
-        QPixmap fondoEscalado = fondoMenu.scaled(800, 600,
-                                                 Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        painter.drawPixmap(0, 0, fondoEscalado);
-    } else {
+    if (!gestor->dibujarSprite(painter, 0, 0, spriteFondo, 800, 600)) {
         // Fallback: degradado oscuro
         QLinearGradient gradiente(0, 0, 0, 600);
         gradiente.setColorAt(0, QColor(50, 0, 0));
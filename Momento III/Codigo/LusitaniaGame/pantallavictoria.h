@@ -4,6 +4,7 @@
 #include <QWidget>
 #include <QPushButton>
 #include <QLabel>
+#include "atlastexturas.h"
 
 class PantallaVictoria : public QWidget {
     Q_OBJECT
@@ -30,6 +31,7 @@ private:
 
     int puntuacion;
     int nivel;
+    SpriteId spriteFondo;
 
     void configurarUI();
 };
@@ -0,0 +1,138 @@
+#include "perfilador.h"
+#include <algorithm>
+
+// ========== CONSTRUCTOR ==========
+
+Perfilador::Perfilador()
+    : indice(0),
+    framesGuardados(0),
+    activo(false) {
+
+    ordenados.reserve(FRAMES_HISTORIAL);
+    limpiar();
+}
+
+Perfilador& Perfilador::delHilo() {
+    thread_local Perfilador perfilador;
+    return perfilador;
+}
+
+// ========== MEDICION ==========
+
+void Perfilador::agregarTiempo(SeccionPerfil seccion, float ms) {
+    if (!activo) return;
+    acumulado[static_cast<int>(seccion)] += ms;
+}
+
+void Perfilador::cerrarFrame(float msFrame) {
+    if (!activo) return;
+
+    acumulado[static_cast<int>(SeccionPerfil::FRAME)] = msFrame;
+
+    // Logica del nivel = simulacion sin la parte del motor de fisica
+    float motor = acumulado[static_cast<int>(SeccionPerfil::FISICA)] +
+                  acumulado[static_cast<int>(SeccionPerfil::ENTIDADES)] +
+                  acumulado[static_cast<int>(SeccionPerfil::COLISIONES)];
+    float logica = acumulado[static_cast<int>(SeccionPerfil::SIMULACION)] - motor;
+    acumulado[static_cast<int>(SeccionPerfil::LOGICA_NIVEL)] = std::max(logica, 0.0f);
+
+    for (int s = 0; s < NUM_SECCIONES; s++) {
+        historial[s][indice] = acumulado[s];
+        acumulado[s] = 0.0f;
+    }
+
+    indice = (indice + 1) % FRAMES_HISTORIAL;
+    if (framesGuardados < FRAMES_HISTORIAL) {
+        framesGuardados++;
+    }
+}
+
+void Perfilador::limpiar() {
+    for (int s = 0; s < NUM_SECCIONES; s++) {
+        acumulado[s] = 0.0f;
+        for (int f = 0; f < FRAMES_HISTORIAL; f++) {
+            historial[s][f] = 0.0f;
+        }
+    }
+
+    indice = 0;
+    framesGuardados = 0;
+}
+
+void Perfilador::copiarSeccion(SeccionPerfil seccion, const Perfilador& otro) {
+    int s = static_cast<int>(seccion);
+
+    // Alineado por el frame mas reciente: los dos hilos no cierran sus
+    // frames al mismo tiempo, pero a 60 FPS la diferencia no se nota
+    for (int atras = 0; atras < framesGuardados; atras++) {
+        int casilla = (indice - 1 - atras + FRAMES_HISTORIAL) % FRAMES_HISTORIAL;
+        historial[s][casilla] = otro.getMuestra(seccion, atras);
+    }
+}
+
+// ========== ESTADISTICAS ==========
+
+EstadisticasSeccion Perfilador::getEstadisticas(SeccionPerfil seccion) const {
+    EstadisticasSeccion resultado;
+    if (framesGuardados == 0) return resultado;
+
+    const float* muestras = historial[static_cast<int>(seccion)];
+
+    ordenados.clear();
+    float suma = 0.0f;
+    for (int f = 0; f < framesGuardados; f++) {
+        ordenados.push_back(muestras[f]);
+        suma += muestras[f];
+    }
+
+    resultado.minimo = *std::min_element(ordenados.begin(), ordenados.end());
+    resultado.promedio = suma / framesGuardados;
+    resultado.ultimo = getMuestra(seccion, 0);
+
+    // Percentil 99: el valor que solo supera el 1% de los frames
+    int posicion = (framesGuardados * 99 + 99) / 100 - 1;
+    std::nth_element(ordenados.begin(), ordenados.begin() + posicion, ordenados.end());
+    resultado.p99 = ordenados[posicion];
+
+    return resultado;
+}
+
+float Perfilador::getMuestra(SeccionPerfil seccion, int atras) const {
+    if (atras < 0 || atras >= framesGuardados) return 0.0f;
+
+    int f = (indice - 1 - atras + FRAMES_HISTORIAL) % FRAMES_HISTORIAL;
+    return historial[static_cast<int>(seccion)][f];
+}
+
+int Perfilador::getFramesGuardados() const {
+    return framesGuardados;
+}
+
+const char* Perfilador::getNombre(SeccionPerfil seccion) {
+    switch (seccion) {
+    case SeccionPerfil::ENTRADA:      return "Entrada";
+    case SeccionPerfil::SIMULACION:   return "Simulacion";
+    case SeccionPerfil::FISICA:       return "  Fisica";
+    case SeccionPerfil::ENTIDADES:    return "  Entidades";
+    case SeccionPerfil::IA:           return "    IA";
+    case SeccionPerfil::COLISIONES:   return "  Colisiones";
+    case SeccionPerfil::LOGICA_NIVEL: return "  Logica nivel";
+    case SeccionPerfil::GRABACION:    return "Grabacion";
+    case SeccionPerfil::RENDER:       return "Render";
+    case SeccionPerfil::FRAME:        return "Frame";
+    default:                          return "?";
+    }
+}
+
+// ========== ESTADO ==========
+
+void Perfilador::setActivo(bool a) {
+    if (a && !activo) {
+        limpiar();      // Sin huecos viejos en el historial
+    }
+    activo = a;
+}
+
+void Perfilador::alternar() {
+    setActivo(!activo);
+}
@@ -0,0 +1,120 @@
+#ifndef PERFILADOR_H
+#define PERFILADOR_H
+
+#include <QElapsedTimer>
+#include <vector>
+
+// Secciones medidas en cada frame
+// ENTIDADES incluye a IA (los submarinos corren su agente en actualizar)
+// y SIMULACION incluye a FISICA, ENTIDADES y COLISIONES.
+// LOGICA_NIVEL no se mide: es SIMULACION menos las otras tres.
+enum class SeccionPerfil {
+    ENTRADA,         // SimulacionJuego::procesarInput
+    SIMULACION,      // Nivel::actualizar completo (todos los subpasos)
+    FISICA,          // MotorFisica::aplicarFisica + gravedad
+    ENTIDADES,       // Entidad::actualizar de todas las entidades
+    IA,              // AgenteIA::actualizar
+    COLISIONES,      // MotorFisica::verificarColisiones
+    LOGICA_NIVEL,    // Derivada (ver arriba)
+    GRABACION,       // Nivel::renderizar grabado en la instantanea (SimulacionJuego)
+    RENDER,          // GameWidget::paintEvent o VistaOpenGL::paintGL
+    FRAME,           // De un tick del bucle al siguiente
+    CANTIDAD
+};
+
+// Resumen de una seccion en los ultimos frames (milisegundos)
+struct EstadisticasSeccion {
+    float minimo;
+    float promedio;
+    float p99;
+    float ultimo;
+
+    EstadisticasSeccion() : minimo(0.0f), promedio(0.0f), p99(0.0f), ultimo(0.0f) {}
+};
+
+// Perfilador de frames
+// Cada seccion suma su tiempo durante el frame; al cerrar el frame las
+// sumas pasan a un buffer circular con los ultimos FRAMES_HISTORIAL
+// frames, del que salen minimo, promedio y percentil 99.
+//
+// Hay uno por hilo (delHilo), como los pools: el juego activa el del
+// hilo de simulacion y el de la interfaz (solo RENDER), y las
+// simulaciones headless no miden nada. Inactivo, un TemporizadorPerfil
+// solo revisa un bool.
+class Perfilador {
+public:
+    static const int FRAMES_HISTORIAL = 240;     // 4 s a 60 FPS
+    static const int NUM_SECCIONES = static_cast<int>(SeccionPerfil::CANTIDAD);
+
+private:
+    float historial[NUM_SECCIONES][FRAMES_HISTORIAL];   // Buffer circular (ms)
+    float acumulado[NUM_SECCIONES];                     // Frame en curso (ms)
+    int indice;                 // Siguiente casilla a escribir
+    int framesGuardados;        // Hasta FRAMES_HISTORIAL
+    bool activo;
+
+    mutable std::vector<float> ordenados;   // Copia para el percentil (sin reservar cada vez)
+
+public:
+    // ========== CONSTRUCTOR ==========
+    Perfilador();
+
+    // Perfilador del hilo actual
+    static Perfilador& delHilo();
+
+    // ========== MEDICION ==========
+    void agregarTiempo(SeccionPerfil seccion, float ms);
+
+    // Guarda el frame en curso y empieza el siguiente (una vez por tick)
+    // msFrame: tiempo real desde el tick anterior
+    void cerrarFrame(float msFrame);
+    void limpiar();
+
+    // Trae el historial de una seccion medida en otro hilo (RENDER de
+    // la GUI sobre la copia del perfilador de la simulacion)
+    void copiarSeccion(SeccionPerfil seccion, const Perfilador& otro);
+
+    // ========== ESTADISTICAS ==========
+    EstadisticasSeccion getEstadisticas(SeccionPerfil seccion) const;
+
+    // Valor de una seccion hace 'atras' frames (0 = el ultimo cerrado)
+    float getMuestra(SeccionPerfil seccion, int atras) const;
+    int getFramesGuardados() const;
+
+    static const char* getNombre(SeccionPerfil seccion);
+
+    // ========== ESTADO ==========
+    bool estaActivo() const { return activo; }
+    void setActivo(bool a);
+    void alternar();
+};
+
+// Mide el tiempo de su bloque y lo suma a una seccion
+// Uso: { TemporizadorPerfil t(SeccionPerfil::COLISIONES); ... }
+class TemporizadorPerfil {
+private:
+    Perfilador* perfilador;     // nullptr si el perfilador esta inactivo
+    SeccionPerfil seccion;
+    QElapsedTimer reloj;
+
+public:
+    explicit TemporizadorPerfil(SeccionPerfil s)
+        : perfilador(nullptr), seccion(s) {
+        Perfilador& p = Perfilador::delHilo();
+        if (p.estaActivo()) {
+            perfilador = &p;
+            reloj.start();
+        }
+    }
+
+    ~TemporizadorPerfil() {
+        if (perfilador) {
+            perfilador->agregarTiempo(seccion, reloj.nsecsElapsed() / 1.0e6f);
+        }
+    }
+
+    TemporizadorPerfil(const TemporizadorPerfil&) = delete;
+    TemporizadorPerfil& operator=(const TemporizadorPerfil&) = delete;
+};
+
+#endif // PERFILADOR_H
@@ -0,0 +1,114 @@
+#ifndef POOLOBJETOS_H
+#define POOLOBJETOS_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Pool de objetos de un mismo tipo (arena con lista libre)
+// Reserva memoria en bloques de N casillas y reutiliza las casillas
+// liberadas en vez de volver a pedir memoria al sistema: despues de
+// los primeros segundos de juego crear y destruir torpedos, vortices o
+// sus componentes de fisica no hace ninguna reserva en el heap.
+//
+// Las clases lo usan desde su propio operator new / operator delete
+// (reservarMemoria / liberarMemoria), asi el resto del codigo sigue
+// usando new y delete normalmente.
+//
+// Hay un pool por hilo (delHilo): las simulaciones paralelas no se
+// bloquean entre si. Un objeto debe liberarse en el mismo hilo que
+// lo creo (cada nivel se crea, simula y destruye en un solo hilo).
+template <typename T, size_t CasillasPorBloque = 64>
+class PoolObjetos {
+private:
+    union Casilla {
+        Casilla* siguiente;                         // Libre: enlace al siguiente libre
+        alignas(T) unsigned char datos[sizeof(T)];  // En uso: el objeto
+    };
+
+    std::vector<Casilla*> bloques;   // Memoria reservada (se libera al destruir el pool)
+    Casilla* libres;                 // Cabeza de la lista libre
+    size_t enUso;
+
+    void agregarBloque() {
+        Casilla* bloque = static_cast<Casilla*>(::operator new(sizeof(Casilla) * CasillasPorBloque));
+        bloques.push_back(bloque);
+
+        // Encadenar las casillas nuevas al frente de la lista libre
+        for (size_t i = CasillasPorBloque; i > 0; i--) {
+            bloque[i - 1].siguiente = libres;
+            libres = &bloque[i - 1];
+        }
+    }
+
+public:
+    // ========== CONSTRUCTOR ==========
+    PoolObjetos() : libres(nullptr), enUso(0) {}
+
+    ~PoolObjetos() {
+        for (Casilla* bloque : bloques) {
+            ::operator delete(bloque);
+        }
+    }
+
+    PoolObjetos(const PoolObjetos&) = delete;
+    PoolObjetos& operator=(const PoolObjetos&) = delete;
+
+    // ========== MEMORIA ==========
+    // Memoria sin construir para un T (usar con placement new)
+    void* reservar() {
+        if (!libres) {
+            agregarBloque();
+        }
+
+        Casilla* casilla = libres;
+        libres = casilla->siguiente;
+        enUso++;
+        return casilla->datos;
+    }
+
+    // Devuelve la casilla a la lista libre (el objeto ya fue destruido)
+    void devolver(void* memoria) {
+        if (!memoria) return;
+
+        Casilla* casilla = reinterpret_cast<Casilla*>(memoria);
+        casilla->siguiente = libres;
+        libres = casilla;
+        enUso--;
+    }
+
+    // Pide memoria por adelantado para n objetos
+    void precalentar(size_t n) {
+        while (bloques.size() * CasillasPorBloque < n) {
+            agregarBloque();
+        }
+    }
+
+    // ========== GETTERS ==========
+    size_t getEnUso() const { return enUso; }
+    size_t getCapacidad() const { return bloques.size() * CasillasPorBloque; }
+
+    // Pool del hilo actual
+    static PoolObjetos& delHilo() {
+        thread_local PoolObjetos pool;
+        return pool;
+    }
+
+    // ========== PARA operator new / operator delete ==========
+    // Una clase derivada de T tiene otro tamanio: esa va al heap normal
+    static void* reservarMemoria(std::size_t tamanio) {
+        if (tamanio != sizeof(T)) return ::operator new(tamanio);
+        return delHilo().reservar();
+    }
+
+    static void liberarMemoria(void* memoria, std::size_t tamanio) {
+        if (!memoria) return;
+        if (tamanio != sizeof(T)) {
+            ::operator delete(memoria);
+            return;
+        }
+        delHilo().devolver(memoria);
+    }
+};
+
+#endif // POOLOBJETOS_H
@@ -0,0 +1,106 @@
+#include "registroentidades.h"
+
+// ========== CONSTRUCTOR ==========
+
+RegistroEntidades::RegistroEntidades()
+    : primeraLibre(HandleEntidad::NULO) {
+}
+
+RegistroEntidades::~RegistroEntidades() {
+    limpiar();
+}
+
+// ========== ALTA Y BAJA ==========
+
+HandleEntidad RegistroEntidades::agregar(Entidad* e) {
+    if (!e) return HandleEntidad();
+
+    // Reusar una ranura libre (conserva su generacion) o crear otra
+    uint32_t indice;
+    if (primeraLibre != HandleEntidad::NULO) {
+        indice = primeraLibre;
+        primeraLibre = ranuras[indice].siguiente;
+    } else {
+        indice = (uint32_t)ranuras.size();
+        ranuras.emplace_back();
+    }
+
+    Ranura& ranura = ranuras[indice];
+    ranura.entidad = e;
+    ranura.siguiente = HandleEntidad::NULO;
+    densas.push_back(e);
+
+    HandleEntidad h(indice, ranura.generacion);
+    e->setHandle(h);
+    return h;
+}
+
+void RegistroEntidades::retirar(const HandleEntidad& h) {
+    Entidad* e = obtener(h);
+    if (e) {
+        e->setActivo(false);
+    }
+}
+
+void RegistroEntidades::liberarRanura(uint32_t indice) {
+    Ranura& ranura = ranuras[indice];
+    ranura.entidad->setHandle(HandleEntidad());
+    ranura.entidad = nullptr;
+    ranura.generacion++;
+    ranura.siguiente = primeraLibre;
+    primeraLibre = indice;
+}
+
+void RegistroEntidades::compactar() {
+    // Una sola pasada: las activas se corren hacia adelante conservando
+    // el orden (el orden de las colisiones no cambia). Las ranuras no se
+    // mueven, asi que los handles de las activas siguen valiendo
+    size_t destino = 0;
+
+    for (size_t i = 0; i < densas.size(); i++) {
+        Entidad* entidad = densas[i];
+
+        if (!entidad->estaActivo()) {
+            // No se borra todavia: alguien pudo haber tomado el puntero
+            // con obtener() durante este paso. Se borra en el siguiente
+            liberarRanura(entidad->getHandle().ranura);
+            pendientes.push_back(entidad);
+        } else {
+            densas[destino++] = entidad;
+        }
+    }
+
+    densas.resize(destino);
+}
+
+void RegistroEntidades::liberarPendientes() {
+    for (auto* entidad : pendientes) {
+        delete entidad;
+    }
+    pendientes.clear();
+}
+
+void RegistroEntidades::limpiar() {
+    for (auto* entidad : densas) {
+        liberarRanura(entidad->getHandle().ranura);
+        delete entidad;
+    }
+    densas.clear();
+
+    liberarPendientes();
+}
+
+// ========== CONSULTA ==========
+
+Entidad* RegistroEntidades::obtener(const HandleEntidad& h) const {
+    if (h.ranura >= ranuras.size()) return nullptr;
+
+    const Ranura& ranura = ranuras[h.ranura];
+    if (ranura.generacion != h.generacion) return nullptr;
+
+    return ranura.entidad;
+}
+
+bool RegistroEntidades::esValido(const HandleEntidad& h) const {
+    return obtener(h) != nullptr;
+}
@@ -0,0 +1,68 @@
+#ifndef REGISTROENTIDADES_H
+#define REGISTROENTIDADES_H
+
+#include "entidad.h"
+#include "tipos.h"
+#include <vector>
+
+// Registro de las entidades del MotorFisica
+// Las entidades vivas estan en un arreglo denso (el que se recorre cada
+// paso) y cada una tiene ademas una ranura fija que no se mueve aunque
+// el arreglo se compacte. Fuera del motor se guardan HandleEntidad
+// (ranura + generacion): obtener() los valida en O(1) y devuelve
+// nullptr si la entidad ya se retiro, en vez de un puntero colgando.
+//
+// Retirar es diferido: compactar() saca las inactivas del arreglo en
+// una sola pasada al final del paso (invalida sus handles) y las borra
+// liberarPendientes() al inicio del siguiente, cuando ya nadie las
+// esta recorriendo.
+class RegistroEntidades {
+private:
+    struct Ranura {
+        Entidad* entidad;           // nullptr = libre
+        uint32_t generacion;        // Sube cada vez que se libera
+        uint32_t siguiente;         // Si esta libre: la siguiente libre
+
+        Ranura() : entidad(nullptr), generacion(0), siguiente(HandleEntidad::NULO) {}
+    };
+
+    std::vector<Entidad*> densas;           // Vivas, en orden de alta
+    std::vector<Ranura> ranuras;
+    uint32_t primeraLibre;                  // Lista de ranuras libres (NULO = vacia)
+    std::vector<Entidad*> pendientes;       // Retiradas, se borran en liberarPendientes()
+
+    void liberarRanura(uint32_t indice);
+
+public:
+    // ========== CONSTRUCTOR ==========
+    RegistroEntidades();
+    ~RegistroEntidades();
+
+    RegistroEntidades(const RegistroEntidades&) = delete;
+    RegistroEntidades& operator=(const RegistroEntidades&) = delete;
+
+    // ========== ALTA Y BAJA ==========
+    HandleEntidad agregar(Entidad* e);
+    // Desactiva la entidad; sale del registro en el proximo compactar()
+    void retirar(const HandleEntidad& h);
+    // Saca las inactivas conservando el orden de las demas (O(n))
+    void compactar();
+    void liberarPendientes();
+    // Borra todo ya (fin del nivel)
+    void limpiar();
+
+    // ========== CONSULTA ==========
+    Entidad* obtener(const HandleEntidad& h) const;
+    bool esValido(const HandleEntidad& h) const;
+
+    // Con el tipo que se sabe que tiene (el de quien la agrego)
+    template <typename T>
+    T* obtenerComo(const HandleEntidad& h) const {
+        return static_cast<T*>(obtener(h));
+    }
+
+    const std::vector<Entidad*>& getDensas() const { return densas; }
+    int getCantidad() const { return (int)densas.size(); }
+};
+
+#endif // REGISTROENTIDADES_H
@@ -0,0 +1,357 @@
+#include "renderizadorgl.h"
+#include <QDebug>
+#include <QImage>
+#include <QOpenGLContext>
+#include <cstddef>
+
+namespace {
+
+// Atributos: 0 = esquina del quad; 1..7 = por instancia (InstanciaLote)
+enum Atributo {
+    ATRIBUTO_ESQUINA = 0,
+    ATRIBUTO_EJE,
+    ATRIBUTO_TRASLACION,
+    ATRIBUTO_FUENTE,
+    ATRIBUTO_RELLENO,
+    ATRIBUTO_BORDE,
+    ATRIBUTO_TAMANO_GROSOR,
+    ATRIBUTO_FORMA_ARISTAS
+};
+
+const char* const SHADER_VERTICES = R"(
+in vec2 esquina;
+in vec4 eje;
+in vec2 traslacion;
+in vec4 fuente;
+in vec4 relleno;
+in vec4 borde;
+in vec3 tamanoGrosor;
+in vec2 formaAristas;
+
+uniform vec2 tamanoVista;
+
+out vec2 vEsquina;
+out vec2 vCoordTextura;
+flat out vec4 vRelleno;
+flat out vec4 vBorde;
+flat out vec3 vTamanoGrosor;
+flat out vec2 vFormaAristas;
+
+void main() {
+    // Las figuras crecen un pixel hacia afuera para que el borde
+    // suavizado no quede cortado por el quad; los sprites no (leerian
+    // fuera de su region)
+    vec2 margen = vec2(0.0);
+    if (formaAristas.x < 2.5) {
+        margen = 1.0 / max(vec2(length(eje.xy), length(eje.zw)), vec2(1e-4));
+    }
+    vec2 e = esquina * (1.0 + 2.0 * margen) - margen;
+
+    vec2 p = vec2(eje.x * e.x + eje.z * e.y, eje.y * e.x + eje.w * e.y) + traslacion;
+    gl_Position = vec4(p.x / tamanoVista.x * 2.0 - 1.0, 1.0 - p.y / tamanoVista.y * 2.0, 0.0, 1.0);
+
+    vEsquina = e;
+    vCoordTextura = fuente.xy + e * fuente.zw;
+    vRelleno = relleno;
+    vBorde = borde;
+    vTamanoGrosor = tamanoGrosor;
+    vFormaAristas = formaAristas;
+}
+)";
+
+const char* const SHADER_FRAGMENTOS = R"(
+in vec2 vEsquina;
+in vec2 vCoordTextura;
+flat in vec4 vRelleno;
+flat in vec4 vBorde;
+flat in vec3 vTamanoGrosor;
+flat in vec2 vFormaAristas;
+
+uniform sampler2D textura;
+
+out vec4 colorFinal;
+
+float distanciaCaja(vec2 p, vec2 semiejes) {
+    vec2 d = abs(p) - semiejes;
+    return length(max(d, 0.0)) + min(max(d.x, d.y), 0.0);
+}
+
+// Aproximacion de primer orden: exacta sobre el borde, que es donde se suaviza
+float distanciaElipse(vec2 p, vec2 semiejes) {
+    float k0 = length(p / semiejes);
+    float k1 = length(p / (semiejes * semiejes));
+    return k0 * (k0 - 1.0) / max(k1, 1e-6);
+}
+
+void main() {
+    int forma = int(vFormaAristas.x + 0.5);
+
+    if (forma == 3) {
+        colorFinal = texture(textura, vCoordTextura) * vRelleno.a;
+        return;
+    }
+
+    if (forma == 2) {
+        // Baricentricas: cada arista es donde una de ellas vale 0. Solo
+        // las exteriores se suavizan; las diagonales internas cortan seco
+        vec3 b = vec3(1.0 - vEsquina.x - vEsquina.y, vEsquina.x, vEsquina.y);
+        vec3 suave = clamp(b / max(fwidth(b), vec3(1e-6)) + 0.5, 0.0, 1.0);
+        vec3 seco = step(0.0, b);
+
+        int aristas = int(vFormaAristas.y + 0.5);
+        float cobertura = ((aristas & 1) != 0 ? suave.x : seco.x) *
+                          ((aristas & 2) != 0 ? suave.y : seco.y) *
+                          ((aristas & 4) != 0 ? suave.z : seco.z);
+        if (cobertura <= 0.0) discard;
+
+        colorFinal = vRelleno * cobertura;
+        return;
+    }
+
+    vec2 semiejes = vTamanoGrosor.xy * 0.5;
+    vec2 p = vEsquina * vTamanoGrosor.xy - semiejes;
+    float d = forma == 1 ? distanciaElipse(p, semiejes) : distanciaCaja(p, semiejes);
+
+    float suavizado = max(fwidth(d), 1e-4);
+    float cobertura = clamp(0.5 - d / suavizado, 0.0, 1.0);
+    if (cobertura <= 0.0) discard;
+
+    float interior = 1.0;
+    if (vTamanoGrosor.z > 0.0) {
+        interior = clamp(0.5 - (d + vTamanoGrosor.z) / suavizado, 0.0, 1.0);
+    }
+
+    colorFinal = mix(vBorde, vRelleno, interior) * cobertura;
+}
+)";
+
+} // namespace
+
+// ========== CONSTRUCTOR ==========
+
+RenderizadorGL::RenderizadorGL()
+    : programa(nullptr),
+    bufferQuad(QOpenGLBuffer::VertexBuffer),
+    bufferInstancias(QOpenGLBuffer::VertexBuffer),
+    ubicacionTamanoVista(-1),
+    inicializado(false),
+    frame(0),
+    llamadas(0) {
+}
+
+RenderizadorGL::~RenderizadorGL() {
+    // liberar() necesita el contexto: lo llama la vista antes de destruirlo
+    if (inicializado) {
+        qWarning() << "[RenderizadorGL] Destruido sin liberar los recursos de OpenGL";
+    }
+}
+
+bool RenderizadorGL::inicializar() {
+    QOpenGLContext* contexto = QOpenGLContext::currentContext();
+    if (!contexto) return false;
+
+    QSurfaceFormat formato = contexto->format();
+    bool versionValida = contexto->isOpenGLES()
+        ? formato.majorVersion() >= 3
+        : formato.version() >= qMakePair(3, 3);
+
+    if (!versionValida) {
+        qWarning() << "[RenderizadorGL] Se necesita OpenGL 3.3 o ES 3.0; el contexto es"
+                   << formato.majorVersion() << "." << formato.minorVersion();
+        return false;
+    }
+
+    initializeOpenGLFunctions();
+
+    // ===== SHADERS =====
+    QByteArray cabecera = contexto->isOpenGLES()
+        ? QByteArray("#version 300 es\nprecision highp float;\nprecision highp int;\n")
+        : QByteArray("#version 330 core\n");
+
+    programa = new QOpenGLShaderProgram();
+    bool compilado =
+        programa->addShaderFromSourceCode(QOpenGLShader::Vertex, cabecera + SHADER_VERTICES) &&
+        programa->addShaderFromSourceCode(QOpenGLShader::Fragment, cabecera + SHADER_FRAGMENTOS);
+
+    programa->bindAttributeLocation("esquina", ATRIBUTO_ESQUINA);
+    programa->bindAttributeLocation("eje", ATRIBUTO_EJE);
+    programa->bindAttributeLocation("traslacion", ATRIBUTO_TRASLACION);
+    programa->bindAttributeLocation("fuente", ATRIBUTO_FUENTE);
+    programa->bindAttributeLocation("relleno", ATRIBUTO_RELLENO);
+    programa->bindAttributeLocation("borde", ATRIBUTO_BORDE);
+    programa->bindAttributeLocation("tamanoGrosor", ATRIBUTO_TAMANO_GROSOR);
+    programa->bindAttributeLocation("formaAristas", ATRIBUTO_FORMA_ARISTAS);
+
+    if (!compilado || !programa->link()) {
+        qWarning() << "[RenderizadorGL] Error en los shaders:" << programa->log();
+        delete programa;
+        programa = nullptr;
+        return false;
+    }
+
+    ubicacionTamanoVista = programa->uniformLocation("tamanoVista");
+    programa->bind();
+    programa->setUniformValue("textura", 0);
+    programa->release();
+
+    // ===== GEOMETRIA =====
+    // Un solo quad [0,1]² (tira de dos triangulos) compartido por todas
+    const GLfloat quad[] = {0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+
+    vao.create();
+    vao.bind();
+
+    bufferQuad.create();
+    bufferQuad.setUsagePattern(QOpenGLBuffer::StaticDraw);
+    bufferQuad.bind();
+    bufferQuad.allocate(quad, sizeof(quad));
+    glEnableVertexAttribArray(ATRIBUTO_ESQUINA);
+    glVertexAttribPointer(ATRIBUTO_ESQUINA, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
+    bufferQuad.release();
+
+    bufferInstancias.create();
+    bufferInstancias.setUsagePattern(QOpenGLBuffer::StreamDraw);
+
+    for (GLuint atributo = ATRIBUTO_EJE; atributo <= ATRIBUTO_FORMA_ARISTAS; atributo++) {
+        glEnableVertexAttribArray(atributo);
+        glVertexAttribDivisor(atributo, 1);
+    }
+
+    vao.release();
+
+    qDebug() << "[RenderizadorGL]" << reinterpret_cast<const char*>(glGetString(GL_RENDERER))
+             << "-" << reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+    inicializado = true;
+    return true;
+}
+
+void RenderizadorGL::liberar() {
+    for (const TexturaGuardada& guardada : texturas) {
+        delete guardada.textura;
+    }
+    texturas.clear();
+    texturasFrame.clear();
+
+    if (bufferInstancias.isCreated()) bufferInstancias.destroy();
+    if (bufferQuad.isCreated()) bufferQuad.destroy();
+    if (vao.isCreated()) vao.destroy();
+
+    delete programa;
+    programa = nullptr;
+
+    inicializado = false;
+}
+
+// ========== TEXTURAS ==========
+
+QOpenGLTexture* RenderizadorGL::obtenerTextura(const QPixmap& pixmap) {
+    qint64 clave = pixmap.cacheKey();
+
+    auto it = texturas.find(clave);
+    if (it != texturas.end()) {
+        it->ultimoFrame = frame;
+        return it->textura;
+    }
+
+    // Premultiplicada, como el atlas: se mezcla con GL_ONE, 1 - alfa
+    QImage imagen = pixmap.toImage().convertToFormat(QImage::Format_RGBA8888_Premultiplied);
+
+    QOpenGLTexture* textura = new QOpenGLTexture(QOpenGLTexture::Target2D);
+    textura->setFormat(QOpenGLTexture::RGBA8_UNorm);
+    textura->setSize(imagen.width(), imagen.height());
+    textura->setMipLevels(1);
+    textura->allocateStorage(QOpenGLTexture::RGBA, QOpenGLTexture::UInt8);
+    textura->setData(QOpenGLTexture::RGBA, QOpenGLTexture::UInt8, imagen.constBits());
+    textura->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
+    textura->setWrapMode(QOpenGLTexture::ClampToEdge);
+
+    texturas.insert(clave, {textura, frame});
+    return textura;
+}
+
+// ========== DIBUJO ==========
+
+void RenderizadorGL::subir(const LoteDibujo& lote) {
+    if (!inicializado) return;
+
+    llamadas = 0;
+
+    // Todo el frame en una sola subida (glBufferData descarta el anterior)
+    const std::vector<InstanciaLote>& instancias = lote.getInstancias();
+    bufferInstancias.bind();
+    bufferInstancias.allocate(instancias.data(), static_cast<int>(instancias.size() * sizeof(InstanciaLote)));
+    bufferInstancias.release();
+
+    texturasFrame.clear();
+    for (const QPixmap& pixmap : lote.getTexturas()) {
+        texturasFrame.append(obtenerTextura(pixmap));
+    }
+}
+
+void RenderizadorGL::apuntarInstancias(int desde) {
+    // Los atributos por instancia apuntan al primero del tramo
+    const GLsizei paso = sizeof(InstanciaLote);
+    const char* base = reinterpret_cast<const char*>(static_cast<size_t>(desde) * sizeof(InstanciaLote));
+
+    glVertexAttribPointer(ATRIBUTO_EJE, 4, GL_FLOAT, GL_FALSE, paso, base + offsetof(InstanciaLote, eje));
+    glVertexAttribPointer(ATRIBUTO_TRASLACION, 2, GL_FLOAT, GL_FALSE, paso, base + offsetof(InstanciaLote, traslacion));
+    glVertexAttribPointer(ATRIBUTO_FUENTE, 4, GL_FLOAT, GL_FALSE, paso, base + offsetof(InstanciaLote, fuente));
+    glVertexAttribPointer(ATRIBUTO_RELLENO, 4, GL_UNSIGNED_BYTE, GL_TRUE, paso, base + offsetof(InstanciaLote, relleno));
+    glVertexAttribPointer(ATRIBUTO_BORDE, 4, GL_UNSIGNED_BYTE, GL_TRUE, paso, base + offsetof(InstanciaLote, borde));
+    glVertexAttribPointer(ATRIBUTO_TAMANO_GROSOR, 3, GL_FLOAT, GL_FALSE, paso, base + offsetof(InstanciaLote, tamano));
+    glVertexAttribPointer(ATRIBUTO_FORMA_ARISTAS, 2, GL_FLOAT, GL_FALSE, paso, base + offsetof(InstanciaLote, forma));
+}
+
+void RenderizadorGL::dibujar(const LoteDibujo& lote, int desde, int hasta) {
+    if (!inicializado || desde >= hasta) return;
+
+    // QPainter (el HUD, los diferidos) deja su estado: se fija el nuestro
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_STENCIL_TEST);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+    programa->bind();
+    programa->setUniformValue(ubicacionTamanoVista,
+                              static_cast<GLfloat>(lote.getTamano().width()),
+                              static_cast<GLfloat>(lote.getTamano().height()));
+
+    vao.bind();
+    bufferInstancias.bind();
+    glActiveTexture(GL_TEXTURE0);
+
+    for (const TramoLote& tramo : lote.getTramos()) {
+        int inicio = qMax(tramo.inicio, desde);
+        int fin = qMin(tramo.inicio + tramo.cantidad, hasta);
+        if (inicio >= fin) continue;
+
+        if (tramo.textura >= 0 && tramo.textura < texturasFrame.size()) {
+            texturasFrame[tramo.textura]->bind(0);
+        }
+
+        apuntarInstancias(inicio);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, fin - inicio);
+        llamadas++;
+    }
+
+    bufferInstancias.release();
+    vao.release();
+    programa->release();
+}
+
+void RenderizadorGL::terminarFrame() {
+    for (auto it = texturas.begin(); it != texturas.end();) {
+        if (frame - it->ultimoFrame > FRAMES_SIN_USO) {
+            delete it->textura;
+            it = texturas.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    texturasFrame.clear();
+    frame++;
+}
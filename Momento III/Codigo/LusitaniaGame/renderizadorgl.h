@@ -0,0 +1,73 @@
+#ifndef RENDERIZADORGL_H
+#define RENDERIZADORGL_H
+
+#include "lotedibujo.h"
+#include <QHash>
+#include <QOpenGLBuffer>
+#include <QOpenGLExtraFunctions>
+#include <QOpenGLShaderProgram>
+#include <QOpenGLTexture>
+#include <QOpenGLVertexArrayObject>
+#include <QVector>
+
+// Dibuja un LoteDibujo con OpenGL 3.3 core (o ES 3.0)
+// Un quad unitario fijo y un buffer con todas las instancias del frame;
+// cada tramo del lote es un glDrawArraysInstanced con su textura. Las
+// formas (rectangulo, elipse, triangulo, sprite) las resuelve el fragment
+// shader, con bordes suavizados por distancia en vez de multisampling.
+//
+// Solo pide lo que tiene Mesa llvmpipe: corre sin GPU con
+// LIBGL_ALWAYS_SOFTWARE=1.
+//
+// Todos los metodos requieren el contexto actual (initializeGL/paintGL).
+class RenderizadorGL : protected QOpenGLExtraFunctions {
+private:
+    struct TexturaGuardada {
+        QOpenGLTexture* textura;
+        int ultimoFrame;
+    };
+
+    QOpenGLShaderProgram* programa;
+    QOpenGLVertexArrayObject vao;
+    QOpenGLBuffer bufferQuad;
+    QOpenGLBuffer bufferInstancias;
+    int ubicacionTamanoVista;
+    bool inicializado;
+
+    // Paginas del atlas y capas estaticas, por QPixmap::cacheKey. Una
+    // capa repintada es otro pixmap: la textura vieja se libera sola
+    // tras FRAMES_SIN_USO frames sin aparecer en el lote
+    QHash<qint64, TexturaGuardada> texturas;
+    QVector<QOpenGLTexture*> texturasFrame;     // Indice del lote -> textura
+    int frame;
+    int llamadas;                               // glDraw* del ultimo frame
+    static const int FRAMES_SIN_USO = 120;
+
+    QOpenGLTexture* obtenerTextura(const QPixmap& pixmap);
+    void apuntarInstancias(int desde);
+
+public:
+    // ========== CONSTRUCTOR ==========
+    RenderizadorGL();
+    ~RenderizadorGL();
+
+    RenderizadorGL(const RenderizadorGL&) = delete;
+    RenderizadorGL& operator=(const RenderizadorGL&) = delete;
+
+    // false = el contexto no llega a 3.3 / ES 3.0 o el shader no compila
+    bool inicializar();
+    void liberar();
+    bool estaInicializado() const { return inicializado; }
+
+    // ========== DIBUJO ==========
+    // Sube las instancias y las texturas nuevas del lote (una vez por frame)
+    void subir(const LoteDibujo& lote);
+    // Instancias [desde, hasta): entre medio pueden ir dibujos diferidos
+    void dibujar(const LoteDibujo& lote, int desde, int hasta);
+    // Libera las texturas que ya no se usan
+    void terminarFrame();
+
+    int getLlamadas() const { return llamadas; }
+};
+
+#endif // RENDERIZADORGL_H
@@ -0,0 +1,423 @@
+#include "simulacionjuego.h"
+#include "gestorsprites.h"
+#include "jugador.h"
+#include "nivel3submarino.h"
+#include <QPainter>
+#include <cmath>
+
+// ========== INSTANTANEA ==========
+
+Instantanea::Instantanea()
+    : numero(0),
+    carga(0),
+    iniciado(false),
+    pausado(false),
+    enLote(false),
+    parcial(false),
+    conPerfilador(false) {
+}
+
+// ========== CONSTRUCTOR ==========
+
+SimulacionJuego::SimulacionJuego(QObject* parent)
+    : QObject(parent),
+    motorJuego(nullptr),
+    timer(nullptr),
+    fpsObjetivo(60),
+    pasoFijo(1.0f / 60.0f),
+    maxSubpasos(5),
+    acumulador(0.0f),
+    alphaInterpolacion(0.0f),
+    juegoIniciado(false),
+    carga(0),
+    publicadas(0),
+    avisoPendiente(false),
+    grabarEnLote(false),
+    escalaLote(1.0) {
+
+    motorJuego = MotorJuego::obtenerInstancia();
+
+    // Hijo de la simulacion: se muda de hilo junto con ella
+    timer = new QTimer(this);
+    timer->setTimerType(Qt::PreciseTimer);
+    connect(timer, &QTimer::timeout, this, &SimulacionJuego::actualizar);
+
+    int intervalo = 1000 / fpsObjetivo;
+    timer->setInterval(intervalo);
+
+    tiempoFrame.start();
+}
+
+SimulacionJuego::~SimulacionJuego() {
+    motorJuego = nullptr;
+}
+
+// ========== CONTROL DEL JUEGO ==========
+
+void SimulacionJuego::iniciar(int nivel) {
+    if (!motorJuego) return;
+
+    motorJuego->cargarNivel(nivel);
+    nivelNuevo();
+
+    timer->start();
+    juegoIniciado = true;
+
+    tiempoFrame.restart();
+}
+
+void SimulacionJuego::pausar() {
+    if (!motorJuego) return;
+
+    motorJuego->pausar();
+    emit pausaCambiada(true);
+}
+
+void SimulacionJuego::reanudar() {
+    if (!motorJuego) return;
+
+    motorJuego->reanudar();
+    emit pausaCambiada(false);
+}
+
+void SimulacionJuego::alternarPausa() {
+    if (!motorJuego) return;
+
+    if (motorJuego->getEstado() == EstadoJuego::JUGANDO) {
+        pausar();
+    } else if (motorJuego->getEstado() == EstadoJuego::PAUSADO) {
+        reanudar();
+    }
+}
+
+void SimulacionJuego::reiniciar() {
+    if (!motorJuego) return;
+
+    motorJuego->reiniciarNivel();
+    nivelNuevo();
+
+    // Tras una derrota el bucle estaba detenido
+    if (juegoIniciado && !timer->isActive()) {
+        timer->start();
+        tiempoFrame.restart();
+    }
+
+    emit musicaNivel(motorJuego->getNumeroNivelActual());
+}
+
+void SimulacionJuego::volverAlMenu() {
+    timer->stop();
+    juegoIniciado = false;
+
+    // El nivel se destruye en este hilo, el mismo que lo creo
+    if (motorJuego) {
+        motorJuego->volverAlMenu();
+    }
+
+    teclasPresionadas.clear();
+
+    // La GUI deja de dibujar el nivel
+    publicar();
+}
+
+void SimulacionJuego::detener() {
+    timer->stop();
+    juegoIniciado = false;
+
+    // Antes de que termine el hilo: sus pools se liberan con el
+    MotorJuego::destruirInstancia();
+    motorJuego = nullptr;
+}
+
+// ========== BUCLE PRINCIPAL ==========
+
+void SimulacionJuego::actualizar() {
+    if (!motorJuego || !juegoIniciado) return;
+
+    // Tiempo real del tick (nanosegundos, no milisegundos enteros)
+    float deltaTime = tiempoFrame.nsecsElapsed() / 1.0e9f;
+    tiempoFrame.restart();
+
+    // El tick anterior (simulacion + grabacion) termina aqui
+    Perfilador::delHilo().cerrarFrame(deltaTime * 1000.0f);
+
+    // Precargas de sprites terminadas: se pasan a la GUI, que crea las paginas
+    GestorSprites::obtenerInstancia()->procesarCargas();
+
+    // Un tiron muy largo (ventana arrastrada, depurador) no debe
+    // convertirse en cientos de pasos de simulacion
+    if (deltaTime > 0.25f) {
+        deltaTime = 0.25f;
+    }
+
+    // ===== SIMULACION A PASO FIJO =====
+    acumulador += deltaTime;
+
+    int subpasos = 0;
+    while (acumulador >= pasoFijo && subpasos < maxSubpasos) {
+        Nivel* nivelPaso = motorJuego->getNivelActual();
+        if (nivelPaso) {
+            nivelPaso->guardarEstadoAnterior();
+        }
+
+        {
+            TemporizadorPerfil t(SeccionPerfil::ENTRADA);
+            procesarInput(pasoFijo);
+        }
+        {
+            TemporizadorPerfil t(SeccionPerfil::SIMULACION);
+            motorJuego->actualizar(pasoFijo);
+        }
+
+        acumulador -= pasoFijo;
+        subpasos++;
+
+        if (nivelPaso && nivelPaso->estaCompletado()) {
+            break;
+        }
+    }
+
+    // Si se alcanzo el limite de pasos, se descarta el atraso:
+    // el juego va mas lento en vez de acumular deuda sin fin
+    if (acumulador >= pasoFijo) {
+        acumulador = std::fmod(acumulador, pasoFijo);
+    }
+
+    alphaInterpolacion = acumulador / pasoFijo;
+
+    Nivel* nivel = motorJuego->getNivelActual();
+    if (nivel) {
+        if (nivel->estaCompletado()) {
+            timer->stop();
+
+            int puntos = nivel->getPuntuacion();
+            int nivelNum = motorJuego->getNumeroNivelActual();
+
+            emit victoria(puntos, nivelNum);
+
+            // Borra 'nivel': de aqui en adelante solo el siguiente
+            motorJuego->siguienteNivel();
+
+            if (motorJuego->getEstado() == EstadoJuego::VICTORIA) {
+                volverAlMenu();
+                emit volvioAlMenu();
+                return;
+            }
+
+            emit musicaNivel(motorJuego->getNumeroNivelActual());
+
+            nivelNuevo();
+            timer->start();
+        } else if (nivel->haFallado()) {
+            // ===== VERIFICAR DERROTA CON DELAY PARA ANIMACION =====
+            Jugador* jugador = nivel->getJugador();
+
+            // Si es nivel 3 y el jugador esta en animacion de muerte, esperar
+            Nivel3Submarino* nivel3 = dynamic_cast<Nivel3Submarino*>(nivel);
+            if (nivel3 && jugador && jugador->estaEnAnimacionMuerte()) {
+                // Esperar 3 segundos para que termine la animacion
+                if (jugador->getTiempoMuerte() >= 3.0f) {
+                    timer->stop();
+                    int puntos = nivel->getPuntuacion();
+                    int nivelNum = motorJuego->getNumeroNivelActual();
+                    emit derrota(puntos, nivelNum);
+                }
+            } else {
+                // Otros niveles o muerte inmediata
+                timer->stop();
+                int puntos = nivel->getPuntuacion();
+                int nivelNum = motorJuego->getNumeroNivelActual();
+                emit derrota(puntos, nivelNum);
+            }
+        }
+    }
+
+    publicar();
+}
+
+void SimulacionJuego::publicar() {
+    TemporizadorPerfil t(SeccionPerfil::GRABACION);
+
+    Instantanea& instantanea = instantaneas.getEscritura();
+    instantanea.numero = ++publicadas;
+    instantanea.carga = carga;
+    instantanea.iniciado = juegoIniciado;
+    instantanea.pausado = motorJuego && motorJuego->estaPausado();
+    instantanea.enLote = grabarEnLote;
+    instantanea.parcial = false;
+    instantanea.regionSucia = QRegion();
+
+    Nivel* nivel = (juegoIniciado && motorJuego) ? motorJuego->getNivelActual() : nullptr;
+
+    if (nivel) {
+        // Grabar entre el paso anterior y el actual
+        nivel->aplicarInterpolacion(alphaInterpolacion);
+
+        if (grabarEnLote) {
+            // OpenGL redibuja todo el frame: sin regiones sucias
+            instantanea.lote.iniciar(tamanoLote, escalaLote);
+
+            QPainter grabador(&instantanea.lote);
+            grabador.setRenderHint(QPainter::Antialiasing);
+            nivel->renderizar(grabador);
+        } else {
+            // Con las mismas posiciones (interpoladas) que se graban
+            instantanea.parcial = nivel->calcularRegionSucia(instantanea.regionSucia);
+
+            instantanea.escena = QPicture();
+            QPainter grabador(&instantanea.escena);
+            grabador.setRenderHint(QPainter::Antialiasing);
+            nivel->renderizar(grabador);
+        }
+
+        nivel->restaurarEstado();
+    }
+
+    instantanea.hud = HUD::capturar(nivel);
+
+    // F3: la GUI dibuja la tabla con una copia (el original sigue midiendo)
+    const Perfilador& perfilador = Perfilador::delHilo();
+    instantanea.conPerfilador = perfilador.estaActivo();
+    if (instantanea.conPerfilador) {
+        instantanea.perfilador = perfilador;
+    }
+
+    instantaneas.publicar();
+
+    if (!avisoPendiente.exchange(true)) {
+        emit instantaneaLista();
+    }
+}
+
+// ========== INSTANTANEAS (HILO DE LA GUI) ==========
+
+bool SimulacionJuego::tomarInstantanea() {
+    return instantaneas.actualizar();
+}
+
+const Instantanea& SimulacionJuego::getInstantanea() const {
+    return instantaneas.getLectura();
+}
+
+void SimulacionJuego::avisoAtendido() {
+    avisoPendiente.store(false);
+}
+
+// ========== PROCESAMIENTO DE INPUT ==========
+
+void SimulacionJuego::nivelNuevo() {
+    // La GUI repinta todo el primer frame de este nivel
+    carga++;
+    reiniciarPasoFijo();
+}
+
+void SimulacionJuego::reiniciarPasoFijo() {
+    // Nivel nuevo o reiniciado: no interpolar desde el estado anterior
+    acumulador = 0.0f;
+    alphaInterpolacion = 0.0f;
+
+    if (motorJuego && motorJuego->getNivelActual()) {
+        motorJuego->getNivelActual()->guardarEstadoAnterior();
+    }
+}
+
+void SimulacionJuego::procesarInput(float dt) {
+    if (!motorJuego) return;
+
+    Nivel* nivel = motorJuego->getNivelActual();
+    if (!nivel) return;
+
+    Jugador* jugador = nivel->getJugador();
+    if (!jugador) return;
+
+    // Pausa
+    if (teclasPresionadas.contains(Qt::Key_P)) {
+        alternarPausa();
+        teclasPresionadas.remove(Qt::Key_P);
+    }
+
+    manejarMovimientoJugador(dt);
+}
+
+void SimulacionJuego::manejarMovimientoJugador(float dt) {
+    if (!motorJuego) return;
+
+    Nivel* nivel = motorJuego->getNivelActual();
+    if (!nivel) return;
+
+    // Traducir teclado a entrada del nivel
+    EntradaJugador entrada;
+
+    // WASD / Flechas para movimiento
+    if (teclasPresionadas.contains(Qt::Key_W) ||
+        teclasPresionadas.contains(Qt::Key_Up)) {
+        entrada.direccion.y -= 1.0f;
+    }
+
+    if (teclasPresionadas.contains(Qt::Key_S) ||
+        teclasPresionadas.contains(Qt::Key_Down)) {
+        entrada.direccion.y += 1.0f;
+    }
+
+    if (teclasPresionadas.contains(Qt::Key_A) ||
+        teclasPresionadas.contains(Qt::Key_Left)) {
+        entrada.direccion.x -= 1.0f;
+    }
+
+    if (teclasPresionadas.contains(Qt::Key_D) ||
+        teclasPresionadas.contains(Qt::Key_Right)) {
+        entrada.direccion.x += 1.0f;
+    }
+
+    // Habilidad especial (Shift)
+    entrada.habilidad = teclasPresionadas.contains(Qt::Key_Shift);
+
+    // Cada nivel decide como mover al jugador (Nivel 3 suma a la velocidad)
+    nivel->aplicarEntrada(entrada, dt);
+}
+
+void SimulacionJuego::teclaPresionada(int tecla) {
+    teclasPresionadas.insert(tecla);
+
+    if (motorJuego) {
+        Nivel* nivel = motorJuego->getNivelActual();
+        if (nivel) {
+            nivel->manejarInput(tecla, true);
+        }
+    }
+}
+
+void SimulacionJuego::teclaSoltada(int tecla) {
+    teclasPresionadas.remove(tecla);
+
+    if (motorJuego) {
+        Nivel* nivel = motorJuego->getNivelActual();
+        if (nivel) {
+            nivel->manejarInput(tecla, false);
+        }
+    }
+}
+
+void SimulacionJuego::alternarPerfilador() {
+    Perfilador::delHilo().alternar();
+}
+
+// ========== CONFIGURACION ==========
+
+void SimulacionJuego::setFrecuenciaSimulacion(int pasosPorSegundo) {
+    if (pasosPorSegundo <= 0) return;
+
+    pasoFijo = 1.0f / pasosPorSegundo;
+    acumulador = 0.0f;
+}
+
+void SimulacionJuego::setMaxSubpasos(int pasos) {
+    if (pasos < 1) pasos = 1;
+    maxSubpasos = pasos;
+}
+
+void SimulacionJuego::setDestino(bool enLote, const QSize& tamano, qreal escala) {
+    grabarEnLote = enLote;
+    tamanoLote = tamano;
+    escalaLote = escala;
+}
@@ -0,0 +1,146 @@
+#ifndef SIMULACIONJUEGO_H
+#define SIMULACIONJUEGO_H
+
+#include "buffertriple.h"
+#include "hud.h"
+#include "lotedibujo.h"
+#include "motorjuego.h"
+#include "perfilador.h"
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPicture>
+#include <QRegion>
+#include <QSet>
+#include <QSize>
+#include <QTimer>
+#include <atomic>
+
+// Todo lo que la GUI necesita para dibujar un frame, grabado en el hilo
+// de simulacion. Una vez publicada no cambia: la GUI la dibuja (y la
+// vuelve a dibujar si hace falta) sin tocar el nivel ni el motor.
+struct Instantanea {
+    quint64 numero;             // Orden de publicacion (0 = ninguna todavia)
+    int carga;                  // Cambia con cada nivel cargado o reiniciado
+    bool iniciado;
+    bool pausado;
+
+    // ===== NIVEL (INTERPOLADO) =====
+    // Grabado una sola vez, en el formato del backend que lo va a dibujar
+    bool enLote;
+    QPicture escena;            // QPainter: se reproduce con drawPicture
+    LoteDibujo lote;            // OpenGL: va directo a RenderizadorGL
+
+    // ===== REPINTADO PARCIAL (SOLO QPAINTER) =====
+    bool parcial;               // false = hay que repintar todo
+    QRegion regionSucia;        // Respecto a la publicacion anterior
+
+    // ===== INTERFAZ =====
+    DatosHUD hud;
+    bool conPerfilador;
+    Perfilador perfilador;      // Copia del de la simulacion (solo con F3)
+
+    Instantanea();
+};
+
+// Bucle del juego en su propio hilo
+// Corre el paso fijo (entrada + MotorJuego::actualizar) y al final de
+// cada tick publica una Instantanea en un triple buffer: la GUI dibuja
+// siempre la ultima publicada y la simulacion no espera a que termine
+// de pintar, ni la GUI a que termine un paso.
+//
+// El nivel solo se toca desde este hilo: se crea, simula, graba y
+// destruye aqui (los pools y el perfilador son por hilo). Los metodos
+// de control se llaman con QMetaObject::invokeMethod desde la GUI; lo
+// que la GUI tiene que hacer (musica, pantallas) sale por señales.
+class SimulacionJuego : public QObject {
+    Q_OBJECT
+
+private:
+    // ===== MOTOR DEL JUEGO =====
+    MotorJuego* motorJuego;
+
+    // ===== BUCLE DEL JUEGO =====
+    QTimer* timer;
+    QElapsedTimer tiempoFrame;
+    int fpsObjetivo;
+
+    // ===== PASO FIJO =====
+    float pasoFijo;               // dt constante de cada paso de simulacion
+    int maxSubpasos;              // Pasos maximos por tick (evita espiral)
+    float acumulador;             // Tiempo real aun no simulado
+    float alphaInterpolacion;     // Fraccion del siguiente paso [0, 1)
+
+    // ===== INPUT =====
+    QSet<int> teclasPresionadas;
+
+    // ===== ESTADO =====
+    bool juegoIniciado;
+    int carga;
+
+    // ===== INSTANTANEAS =====
+    BufferTriple<Instantanea> instantaneas;
+    quint64 publicadas;
+    std::atomic<bool> avisoPendiente;   // instantaneaLista() sin atender
+    bool grabarEnLote;                  // Backend OpenGL
+    QSize tamanoLote;
+    qreal escalaLote;
+
+    // Metodos privados
+    void procesarInput(float dt);
+    void manejarMovimientoJugador(float dt);
+    void reiniciarPasoFijo();
+    void nivelNuevo();
+    // Graba el nivel y el HUD en la casilla libre y la publica
+    void publicar();
+
+public:
+    explicit SimulacionJuego(QObject* parent = nullptr);
+    ~SimulacionJuego();
+
+    // ========== CONTROL (HILO DE SIMULACION) ==========
+    void iniciar(int nivel);
+    void pausar();
+    void reanudar();
+    void alternarPausa();
+    void reiniciar();
+    void volverAlMenu();
+    // Cierre del programa: destruye el motor y su nivel en este hilo
+    void detener();
+
+    // ========== INPUT (HILO DE SIMULACION) ==========
+    void teclaPresionada(int tecla);
+    void teclaSoltada(int tecla);
+    void alternarPerfilador();
+
+    // ========== CONFIGURACION (HILO DE SIMULACION) ==========
+    void setFrecuenciaSimulacion(int pasosPorSegundo);
+    void setMaxSubpasos(int pasos);
+    // OpenGL: grabar LoteDibujo del tamaño de la vista; si no, QPicture
+    void setDestino(bool enLote, const QSize& tamano, qreal escala);
+
+    // ========== INSTANTANEAS (HILO DE LA GUI) ==========
+    // Pasa a la ultima publicada; false si no habia una nueva
+    bool tomarInstantanea();
+    const Instantanea& getInstantanea() const;
+    // Permite el siguiente aviso de instantaneaLista()
+    void avisoAtendido();
+
+signals:
+    // ========== SEÑALES ==========
+    // Hay una instantanea nueva. No se repite hasta avisoAtendido(): si la
+    // GUI va atrasada no se le acumulan eventos
+    void instantaneaLista();
+    void victoria(int puntos, int nivel);
+    void derrota(int puntos, int nivel);
+    void pausaCambiada(bool pausado);
+    // Siguiente nivel o reinicio: la GUI pone su musica
+    void musicaNivel(int nivel);
+    // Se gano el ultimo nivel y el juego volvio solo al menu
+    void volvioAlMenu();
+
+private slots:
+    // ========== SLOT DEL BUCLE =====
+    void actualizar();
+};
+
+#endif // SIMULACIONJUEGO_H
@@ -0,0 +1,196 @@
+#include "simuladorheadless.h"
+#include "motorjuego.h"
+#include <QFile>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QDebug>
+
+// ========== CONSTRUCTOR ==========
+
+SimuladorHeadless::SimuladorHeadless(int nivel)
+    : numeroNivel(nivel),
+    pasoFijo(1.0f / 60.0f),
+    duracionMaxima(0.0f),
+    modoEntrada(ModoEntrada::ALEATORIA),
+    semilla(1),
+    generador(1),
+    tiempoCambioEntrada(0.0f) {
+}
+
+// ========== CONFIGURACION ==========
+
+void SimuladorHeadless::setFrecuenciaSimulacion(int pasosPorSegundo) {
+    if (pasosPorSegundo > 0) {
+        pasoFijo = 1.0f / pasosPorSegundo;
+    }
+}
+
+void SimuladorHeadless::setDuracionMaxima(float segundos) {
+    duracionMaxima = segundos;
+}
+
+void SimuladorHeadless::setModoEntrada(ModoEntrada modo) {
+    modoEntrada = modo;
+}
+
+void SimuladorHeadless::setSemilla(uint64_t s) {
+    semilla = s;
+}
+
+bool SimuladorHeadless::cargarGuion(const QString& ruta) {
+    // Formato: una linea por tramo -> "desde hasta TECLAS"
+    // TECLAS: W A S D para moverse, H para la habilidad
+    // Lineas vacias o que empiezan con # se ignoran
+    QFile archivo(ruta);
+    if (!archivo.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "No se pudo abrir el guion:" << ruta;
+        return false;
+    }
+
+    guion.clear();
+
+    QTextStream entrada(&archivo);
+    while (!entrada.atEnd()) {
+        QString linea = entrada.readLine().trimmed();
+        if (linea.isEmpty() || linea.startsWith("#")) continue;
+
+        QStringList partes = linea.split(' ', Qt::SkipEmptyParts);
+        if (partes.size() < 2) continue;
+
+        TramoGuion tramo;
+        tramo.desde = partes[0].toFloat();
+        tramo.hasta = partes[1].toFloat();
+
+        for (int i = 2; i < partes.size(); i++) {
+            QString teclas = partes[i].toUpper();
+            for (const QChar& c : teclas) {
+                if (c == 'W') tramo.entrada.direccion.y -= 1.0f;
+                else if (c == 'S') tramo.entrada.direccion.y += 1.0f;
+                else if (c == 'A') tramo.entrada.direccion.x -= 1.0f;
+                else if (c == 'D') tramo.entrada.direccion.x += 1.0f;
+                else if (c == 'H') tramo.entrada.habilidad = true;
+            }
+        }
+
+        guion.push_back(tramo);
+    }
+
+    return true;
+}
+
+// ========== ENTRADA ==========
+
+EntradaJugador SimuladorHeadless::generarEntrada(float tiempo) {
+    switch (modoEntrada) {
+    case ModoEntrada::GUION:
+        return entradaDeGuion(tiempo);
+
+    case ModoEntrada::ALEATORIA:
+        if (tiempo >= tiempoCambioEntrada) {
+            entradaAleatoria = siguienteEntradaAleatoria();
+
+            // Mantener la direccion entre 0.3 y 1.5 segundos
+            tiempoCambioEntrada = tiempo + generador.real(0.3f, 1.5f);
+        }
+        return entradaAleatoria;
+
+    case ModoEntrada::NINGUNA:
+    default:
+        return EntradaJugador();
+    }
+}
+
+EntradaJugador SimuladorHeadless::entradaDeGuion(float tiempo) const {
+    // Los tramos que se solapan se suman (como teclas simultaneas)
+    EntradaJugador resultado;
+
+    for (const auto& tramo : guion) {
+        if (tiempo >= tramo.desde && tiempo < tramo.hasta) {
+            resultado.direccion += tramo.entrada.direccion;
+            resultado.habilidad = resultado.habilidad || tramo.entrada.habilidad;
+        }
+    }
+
+    return resultado;
+}
+
+EntradaJugador SimuladorHeadless::siguienteEntradaAleatoria() {
+    EntradaJugador entrada;
+
+    // Cada eje: -1, 0 o 1 (como un jugador con teclado)
+    entrada.direccion.x = static_cast<float>(generador.entero(3) - 1);
+    entrada.direccion.y = static_cast<float>(generador.entero(3) - 1);
+
+    // Habilidad de vez en cuando
+    entrada.habilidad = (generador.entero(10) == 0);
+
+    return entrada;
+}
+
+// ========== EJECUCION ==========
+
+ResultadoEpisodio SimuladorHeadless::ejecutarEpisodio(int indice) {
+    ResultadoEpisodio resultado;
+    resultado.nivel = numeroNivel;
+    resultado.episodio = indice;
+
+    // Semilla distinta por episodio, derivada de la semilla base:
+    // el mismo (semilla, indice) repite exactamente la misma partida
+    GeneradorAleatorio mezclador(semilla + 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(indice + 1));
+    uint64_t semillaEpisodio = (static_cast<uint64_t>(mezclador.siguiente()) << 32) | mezclador.siguiente();
+    if (semillaEpisodio == 0) semillaEpisodio = 1;
+    resultado.semilla = semillaEpisodio;
+
+    Nivel* nivel = MotorJuego::crearNivel(numeroNivel, semillaEpisodio);
+    if (!nivel) {
+        qWarning() << "Nivel invalido:" << numeroNivel;
+        return resultado;
+    }
+
+    // Entrada del jugador con su propia secuencia
+    generador.setSemilla(semillaEpisodio ^ 0xA5A5A5A5A5A5A5A5ULL);
+    entradaAleatoria = EntradaJugador();
+    tiempoCambioEntrada = 0.0f;
+
+    // Sin duracion fija: el limite del nivel con margen (o 5 minutos)
+    float limite = duracionMaxima;
+    if (limite <= 0.0f) {
+        limite = nivel->getTiempoLimite() > 0.0f ? nivel->getTiempoLimite() + 5.0f : 300.0f;
+    }
+
+    QElapsedTimer reloj;
+    reloj.start();
+
+    float tiempo = 0.0f;
+    while (tiempo < limite) {
+        nivel->aplicarEntrada(generarEntrada(tiempo), pasoFijo);
+        nivel->actualizar(pasoFijo);
+
+        tiempo += pasoFijo;
+        resultado.pasos++;
+
+        if (nivel->estaCompletado() || nivel->haFallado()) {
+            break;
+        }
+    }
+
+    resultado.tiempoReal = reloj.nsecsElapsed() / 1.0e9;
+    resultado.tiempoSimulado = tiempo;
+    resultado.puntuacion = nivel->getPuntuacion();
+    resultado.completado = nivel->estaCompletado();
+    resultado.fallado = nivel->haFallado();
+
+    delete nivel;
+    return resultado;
+}
+
+// ========== GETTERS ==========
+
+int SimuladorHeadless::getNumeroNivel() const {
+    return numeroNivel;
+}
+
+float SimuladorHeadless::getPasoFijo() const {
+    return pasoFijo;
+}
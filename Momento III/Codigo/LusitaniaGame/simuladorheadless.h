@@ -0,0 +1,83 @@
+#ifndef SIMULADORHEADLESS_H
+#define SIMULADORHEADLESS_H
+
+#include "nivel.h"
+#include <QString>
+#include <vector>
+#include <cstdint>
+
+// Modo en que se genera la entrada del jugador sin teclado
+enum class ModoEntrada {
+    NINGUNA,        // El jugador no se mueve
+    ALEATORIA,      // Direcciones al azar mantenidas un rato
+    GUION           // Tramos leidos de un archivo
+};
+
+// Tramo de un guion de entrada: [desde, hasta) en segundos simulados
+struct TramoGuion {
+    float desde;
+    float hasta;
+    EntradaJugador entrada;
+
+    TramoGuion() : desde(0.0f), hasta(0.0f) {}
+};
+
+// Resultado de un episodio (una partida de un nivel)
+struct ResultadoEpisodio {
+    int nivel;
+    int episodio;
+    uint64_t semilla;           // Semilla del nivel (para repetir la partida)
+    int puntuacion;
+    bool completado;
+    bool fallado;
+    int pasos;
+    float tiempoSimulado;       // Segundos de juego
+    double tiempoReal;          // Segundos de reloj
+
+    ResultadoEpisodio()
+        : nivel(0), episodio(0), semilla(0), puntuacion(0),
+        completado(false), fallado(false), pasos(0),
+        tiempoSimulado(0.0f), tiempoReal(0.0) {}
+};
+
+// Simulador sin ventana ni render
+// Avanza un nivel a paso fijo tan rapido como permita la CPU,
+// con entrada por guion o aleatoria. Usado por lusitania_headless.
+class SimuladorHeadless {
+private:
+    int numeroNivel;
+    float pasoFijo;                 // dt de cada paso (1/60 por defecto)
+    float duracionMaxima;           // 0 = limite del nivel + margen
+    ModoEntrada modoEntrada;
+    uint64_t semilla;
+    std::vector<TramoGuion> guion;
+
+    // Entrada aleatoria (independiente del generador del nivel)
+    GeneradorAleatorio generador;
+    EntradaJugador entradaAleatoria;
+    float tiempoCambioEntrada;
+
+    EntradaJugador generarEntrada(float tiempo);
+    EntradaJugador entradaDeGuion(float tiempo) const;
+    EntradaJugador siguienteEntradaAleatoria();
+
+public:
+    // ========== CONSTRUCTOR ==========
+    SimuladorHeadless(int nivel);
+
+    // ========== CONFIGURACION ==========
+    void setFrecuenciaSimulacion(int pasosPorSegundo);
+    void setDuracionMaxima(float segundos);
+    void setModoEntrada(ModoEntrada modo);
+    void setSemilla(uint64_t s);
+    bool cargarGuion(const QString& ruta);
+
+    // ========== EJECUCION ==========
+    ResultadoEpisodio ejecutarEpisodio(int indice);
+
+    // ========== GETTERS ==========
+    int getNumeroNivel() const;
+    float getPasoFijo() const;
+};
+
+#endif // SIMULADORHEADLESS_H
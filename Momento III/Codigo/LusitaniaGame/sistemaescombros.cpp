@@ -0,0 +1,344 @@
+#include "sistemaescombros.h"
+#include "fisicavortice.h"
+#include <QColor>
+#include <algorithm>
+#include <cmath>
+
+// ========== CONSTRUCTOR ==========
+
+SistemaEscombros::SistemaEscombros()
+    : interpolando(false),
+    gravedadAgua(98.0f),
+    friccion(0.98f),
+    limiteSuperior(-500.0f),
+    limiteInferior(4000.0f),
+    siguienteId(1) {
+}
+
+// ========== GESTION ==========
+
+int SistemaEscombros::agregar(const Vector2D& pos, TipoEscombro tipo) {
+    // Densidad, velocidad terminal y tamanio segun el tipo
+    float rho = 1.0f;
+    float terminal = 50.0f;
+    float w = 24.0f;
+    float h = 24.0f;
+
+    switch (tipo) {
+    case TipoEscombro::MADERA:
+        rho = 0.6f;         // Flota
+        terminal = 80.0f;
+        w = 32.0f; h = 16.0f;
+        break;
+
+    case TipoEscombro::METAL_PESADO:
+        rho = 3.0f;         // Se hunde rapido
+        terminal = 200.0f;
+        w = 20.0f; h = 20.0f;
+        break;
+
+    case TipoEscombro::SALVAVIDAS:
+        rho = 0.3f;         // Flota muy rapido
+        terminal = 120.0f;
+        w = 28.0f; h = 28.0f;
+        break;
+
+    case TipoEscombro::NEUTRO:
+        rho = 1.0f;         // Neutro
+        terminal = 50.0f;
+        w = 24.0f; h = 24.0f;
+        break;
+    }
+
+    posX.push_back(pos.x);
+    posY.push_back(pos.y);
+    velX.push_back(0.0f);
+    velY.push_back(0.0f);
+    densidad.push_back(rho);
+    velocidadTerminal.push_back(terminal);
+    ancho.push_back(w);
+    alto.push_back(h);
+    tipos.push_back(tipo);
+    ids.push_back(siguienteId);
+
+    anteriorX.push_back(pos.x);
+    anteriorY.push_back(pos.y);
+    simuladaX.push_back(pos.x);
+    simuladaY.push_back(pos.y);
+
+    return siguienteId++;
+}
+
+void SistemaEscombros::eliminar(size_t i) {
+    if (i >= posX.size()) return;
+
+    // Intercambiar con el ultimo y quitar el ultimo: O(1), sin huecos
+    size_t ultimo = posX.size() - 1;
+
+    if (i != ultimo) {
+        posX[i] = posX[ultimo];
+        posY[i] = posY[ultimo];
+        velX[i] = velX[ultimo];
+        velY[i] = velY[ultimo];
+        densidad[i] = densidad[ultimo];
+        velocidadTerminal[i] = velocidadTerminal[ultimo];
+        ancho[i] = ancho[ultimo];
+        alto[i] = alto[ultimo];
+        tipos[i] = tipos[ultimo];
+        ids[i] = ids[ultimo];
+        anteriorX[i] = anteriorX[ultimo];
+        anteriorY[i] = anteriorY[ultimo];
+        simuladaX[i] = simuladaX[ultimo];
+        simuladaY[i] = simuladaY[ultimo];
+    }
+
+    posX.pop_back();
+    posY.pop_back();
+    velX.pop_back();
+    velY.pop_back();
+    densidad.pop_back();
+    velocidadTerminal.pop_back();
+    ancho.pop_back();
+    alto.pop_back();
+    tipos.pop_back();
+    ids.pop_back();
+    anteriorX.pop_back();
+    anteriorY.pop_back();
+    simuladaX.pop_back();
+    simuladaY.pop_back();
+}
+
+void SistemaEscombros::limpiar() {
+    // clear() conserva la capacidad: un reinicio no vuelve a reservar
+    posX.clear();
+    posY.clear();
+    velX.clear();
+    velY.clear();
+    densidad.clear();
+    velocidadTerminal.clear();
+    ancho.clear();
+    alto.clear();
+    tipos.clear();
+    ids.clear();
+    anteriorX.clear();
+    anteriorY.clear();
+    simuladaX.clear();
+    simuladaY.clear();
+    interpolando = false;
+}
+
+void SistemaEscombros::reservar(size_t capacidad) {
+    posX.reserve(capacidad);
+    posY.reserve(capacidad);
+    velX.reserve(capacidad);
+    velY.reserve(capacidad);
+    densidad.reserve(capacidad);
+    velocidadTerminal.reserve(capacidad);
+    ancho.reserve(capacidad);
+    alto.reserve(capacidad);
+    tipos.reserve(capacidad);
+    ids.reserve(capacidad);
+    anteriorX.reserve(capacidad);
+    anteriorY.reserve(capacidad);
+    simuladaX.reserve(capacidad);
+    simuladaY.reserve(capacidad);
+}
+
+int SistemaEscombros::buscar(int id) const {
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (ids[i] == id) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// ========== SIMULACION ==========
+
+// Nucleo de la integracion: funcion libre con punteros __restrict
+// (sin aliasing entre arreglos) y sin saltos dentro del ciclo, para
+// que el compilador la vectorice. Solo esta funcion se compila con -O3
+// y sin trampas de punto flotante; el resto del nucleo conserva las
+// opciones del proyecto (clang ya vectoriza este ciclo con -O2)
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("O3", "no-math-errno", "no-trapping-math")
+#endif
+
+static void integrarFlotacion(int n,
+                              float* __restrict px, float* __restrict py,
+                              float* __restrict vx, float* __restrict vy,
+                              const float* __restrict rho, const float* __restrict vt,
+                              float gravedad, float friccion, float dt) {
+    for (int i = 0; i < n; i++) {
+        // Flotacion: ρ < 1 -> aceleracion negativa (sube)
+        float nuevaVy = vy[i] + gravedad * (rho[i] - 1.0f) * dt;
+
+        // Velocidad terminal (las mismas comparaciones que std::max y
+        // std::min, escritas aqui: las plantillas de <algorithm> no se
+        // compilan con este optimize y no se integrarian en el ciclo)
+        nuevaVy = (nuevaVy < -vt[i]) ? -vt[i] : nuevaVy;
+        nuevaVy = (vt[i] < nuevaVy) ? vt[i] : nuevaVy;
+
+        // Friccion del agua
+        float nuevaVx = vx[i] * friccion;
+        nuevaVy *= friccion;
+
+        vx[i] = nuevaVx;
+        vy[i] = nuevaVy;
+        px[i] += nuevaVx * dt;
+        py[i] += nuevaVy * dt;
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
+
+void SistemaEscombros::integrar(float dt) {
+    integrarFlotacion(static_cast<int>(posX.size()),
+                      posX.data(), posY.data(), velX.data(), velY.data(),
+                      densidad.data(), velocidadTerminal.data(),
+                      gravedadAgua, friccion, dt);
+}
+
+void SistemaEscombros::aplicarAtraccion(const Vector2D& centro, float rango, float fuerzaMaxima, float dt) {
+    // Nucleo SIMD de FisicaVortice, solo radial (sin componente tangencial)
+    FisicaVortice::aplicarCampoLote(centro, rango, fuerzaMaxima, 0.0f,
+                                    posX.data(), posY.data(), velX.data(), velY.data(),
+                                    posX.size(), dt);
+}
+
+void SistemaEscombros::aplicarCampo(const CampoVortices& campo, float dt) {
+    campo.aplicarLote(posX.data(), posY.data(), velX.data(), velY.data(), posX.size(), dt);
+}
+
+bool SistemaEscombros::estaFueraDeLimites(size_t i) const {
+    return posY[i] > limiteInferior || posY[i] < limiteSuperior;
+}
+
+bool SistemaEscombros::colisionaCon(size_t i, const CajaColision& caja) const {
+    return getCaja(i).colisionaCon(caja);
+}
+
+// ========== INTERPOLACION ==========
+
+void SistemaEscombros::guardarPosicionesAnteriores() {
+    anteriorX = posX;
+    anteriorY = posY;
+}
+
+void SistemaEscombros::interpolar(float alpha) {
+    if (interpolando) return;
+
+    simuladaX = posX;
+    simuladaY = posY;
+
+    for (size_t i = 0; i < posX.size(); i++) {
+        posX[i] = anteriorX[i] + (simuladaX[i] - anteriorX[i]) * alpha;
+        posY[i] = anteriorY[i] + (simuladaY[i] - anteriorY[i]) * alpha;
+    }
+
+    interpolando = true;
+}
+
+void SistemaEscombros::restaurar() {
+    if (!interpolando) return;
+
+    posX = simuladaX;
+    posY = simuladaY;
+    interpolando = false;
+}
+
+// ========== RENDERIZADO ==========
+
+void SistemaEscombros::renderizar(QPainter& painter, const QRectF& visible) const {
+    // La flecha de direccion sobresale 15 px arriba o abajo, el borde 2
+    const float margenX = 2.0f;
+    const float margenY = 17.0f;
+
+    float izquierda = visible.left();
+    float derecha = visible.right();
+    float arriba = visible.top();
+    float abajo = visible.bottom();
+
+    for (size_t i = 0; i < posX.size(); i++) {
+        if (posX[i] + ancho[i] + margenX < izquierda || posX[i] - margenX > derecha ||
+            posY[i] + alto[i] + margenY < arriba || posY[i] - margenY > abajo) {
+            continue;
+        }
+
+        renderizarEscombro(painter, i);
+    }
+}
+
+void SistemaEscombros::renderizarEscombro(QPainter& painter, size_t i) const {
+    float x = posX[i];
+    float y = posY[i];
+    float w = ancho[i];
+    float h = alto[i];
+
+    painter.setPen(QPen(Qt::black, 2));
+
+    switch (tipos[i]) {
+    case TipoEscombro::MADERA:
+        painter.setBrush(QColor(139, 69, 19));
+        painter.drawRect(x, y, w, h);
+
+        painter.setPen(QColor(101, 50, 10));
+        painter.drawLine(x, y + h/2, x + w, y + h/2);
+        break;
+
+    case TipoEscombro::METAL_PESADO:
+        painter.setBrush(QColor(100, 100, 100));
+        painter.drawRect(x, y, w, h);
+
+        painter.setBrush(QColor(150, 150, 150));
+        painter.drawEllipse(x + 3, y + 3, 5, 5);
+        painter.drawEllipse(x + w - 8, y + 3, 5, 5);
+        break;
+
+    case TipoEscombro::SALVAVIDAS:
+        painter.setBrush(QColor(255, 100, 0));
+        painter.drawEllipse(x, y, w, h);
+
+        painter.setBrush(QColor(20, 60, 100, 150));
+        painter.drawEllipse(x + w/4, y + h/4, w/2, h/2);
+
+        painter.setPen(QPen(Qt::white, 4));
+        painter.drawLine(x, y + h/2, x + w/4, y + h/2);
+        painter.drawLine(x + 3*w/4, y + h/2, x + w, y + h/2);
+        break;
+
+    case TipoEscombro::NEUTRO:
+        painter.setBrush(QColor(100, 150, 180));
+        painter.drawRect(x, y, w, h);
+        break;
+    }
+
+    // Indicador de direccion (flecha)
+    painter.setPen(QPen(Qt::white, 2));
+    if (velY[i] < -10.0f) {
+        // Flecha arriba (flotando)
+        painter.drawLine(x + w/2, y - 5, x + w/2, y - 15);
+        painter.drawLine(x + w/2 - 3, y - 12, x + w/2, y - 15);
+        painter.drawLine(x + w/2 + 3, y - 12, x + w/2, y - 15);
+    } else if (velY[i] > 10.0f) {
+        // Flecha abajo (hundiendose)
+        painter.drawLine(x + w/2, y + h + 5, x + w/2, y + h + 15);
+        painter.drawLine(x + w/2 - 3, y + h + 12, x + w/2, y + h + 15);
+        painter.drawLine(x + w/2 + 3, y + h + 12, x + w/2, y + h + 15);
+    }
+}
+
+// ========== GETTERS ==========
+
+CajaColision SistemaEscombros::getCaja(size_t i) const {
+    return CajaColision(posX[i], posY[i], ancho[i], alto[i]);
+}
+
+// ========== SETTERS ==========
+
+void SistemaEscombros::setLimitesVerticales(float superior, float inferior) {
+    limiteSuperior = superior;
+    limiteInferior = inferior;
+}
@@ -0,0 +1,96 @@
+#ifndef SISTEMAESCOMBROS_H
+#define SISTEMAESCOMBROS_H
+
+#include "vector2d.h"
+#include "tipos.h"
+#include "campovortices.h"
+#include <QPainter>
+#include <QRectF>
+#include <vector>
+#include <cstddef>
+
+// Sistema de escombros del Nivel 3 (estructura de arreglos)
+// Los escombros no son Entidades: cada dato vive en su propio arreglo
+// contiguo (posX, posY, velX, ...) y la flotacion se integra en un solo
+// ciclo sin llamadas virtuales, que el compilador puede vectorizar.
+//
+// Modelo por paso (el mismo de Escombro::actualizar):
+//   a_y = g_agua × (ρ - 1)      - ρ < 1 sube, ρ > 1 se hunde
+//   v_y = clamp(v_y + a_y·dt, ±v_terminal)
+//   v   = v × friccion           - resistencia del agua (0.98)
+//   p   = p + v·dt
+class SistemaEscombros {
+private:
+    // ===== DATOS (un indice = un escombro) =====
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> densidad;            // ρ del objeto (agua = 1.0)
+    std::vector<float> velocidadTerminal;   // Limite de |v_y|
+    std::vector<float> ancho;
+    std::vector<float> alto;
+    std::vector<TipoEscombro> tipos;
+    std::vector<int> ids;                   // Identificador estable (los indices cambian al eliminar)
+
+    // ===== INTERPOLACION =====
+    std::vector<float> anteriorX;
+    std::vector<float> anteriorY;
+    std::vector<float> simuladaX;
+    std::vector<float> simuladaY;
+    bool interpolando;
+
+    // ===== PARAMETROS =====
+    float gravedadAgua;                     // 98 px/s²
+    float friccion;                         // 0.98 por paso
+    float limiteSuperior;                   // Fuera del mundo por arriba (-500)
+    float limiteInferior;                   // Fuera del mundo por abajo (4000)
+    int siguienteId;
+
+    void renderizarEscombro(QPainter& painter, size_t i) const;
+
+public:
+    // ========== CONSTRUCTOR ==========
+    SistemaEscombros();
+
+    // ========== GESTION ==========
+    int agregar(const Vector2D& pos, TipoEscombro tipo);   // Devuelve el id
+    void eliminar(size_t i);                               // Intercambia con el ultimo
+    void limpiar();
+    void reservar(size_t capacidad);
+    int buscar(int id) const;                              // Indice o -1
+
+    // ========== SIMULACION ==========
+    void integrar(float dt);
+
+    // Atraccion hacia un punto (vortice): F = F_max × (1 - d/rango)²
+    void aplicarAtraccion(const Vector2D& centro, float rango, float fuerzaMaxima, float dt);
+    // Todos los vortices de una vez, leyendo el campo ya construido
+    void aplicarCampo(const CampoVortices& campo, float dt);
+
+    bool estaFueraDeLimites(size_t i) const;
+    bool colisionaCon(size_t i, const CajaColision& caja) const;
+
+    // ========== INTERPOLACION (PASO FIJO) ==========
+    void guardarPosicionesAnteriores();
+    void interpolar(float alpha);
+    void restaurar();
+
+    // ========== RENDERIZADO ==========
+    // Solo los que tocan 'visible' (viewport en coordenadas del mundo):
+    // los de fuera no generan ninguna llamada a QPainter
+    void renderizar(QPainter& painter, const QRectF& visible) const;
+
+    // ========== GETTERS ==========
+    size_t getCantidad() const { return posX.size(); }
+    Vector2D getPosicion(size_t i) const { return Vector2D(posX[i], posY[i]); }
+    Vector2D getVelocidad(size_t i) const { return Vector2D(velX[i], velY[i]); }
+    TipoEscombro getTipo(size_t i) const { return tipos[i]; }
+    int getId(size_t i) const { return ids[i]; }
+    CajaColision getCaja(size_t i) const;
+
+    // ========== SETTERS ==========
+    void setLimitesVerticales(float superior, float inferior);
+};
+
+#endif // SISTEMAESCOMBROS_H
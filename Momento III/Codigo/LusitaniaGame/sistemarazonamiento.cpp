@@ -7,15 +7,17 @@
 // ========== CONSTRUCTOR ==========
 
 SistemaRazonamiento::SistemaRazonamiento()
-    : distanciaEvadir(100.0f),
+    : aleatorio(&GeneradorAleatorio::porDefecto()),
+    distanciaEvadir(100.0f),
     distanciaAtaqueMin(150.0f),
     distanciaAtaqueMax(250.0f),
     distanciaAcercarse(250.0f) {
     // Constructor con perfil por defecto
 }
 
-SistemaRazonamiento::SistemaRazonamiento(const PerfilIA& p)
+SistemaRazonamiento::SistemaRazonamiento(const PerfilIA& p, GeneradorAleatorio* gen)
     : perfil(p),
+    aleatorio(gen ? gen : &GeneradorAleatorio::porDefecto()),
     distanciaEvadir(100.0f),
     distanciaAtaqueMin(150.0f),
     distanciaAtaqueMax(250.0f),
@@ -127,7 +129,7 @@ PlanAccion SistemaRazonamiento::decidir(const DatosPercepcion& percepcion,
         // Decidir si disparar (segun agresividad)
         // Mas agresivo = dispara mas seguido
         float probabilidadDisparo = perfil.agresividad;
-        plan.debeDisparar = (rand() % 100) < (probabilidadDisparo * 100);
+        plan.debeDisparar = aleatorio->entero(100) < (probabilidadDisparo * 100);
 
         plan.prioridad = 0.8f;
 
@@ -3,6 +3,7 @@
 
 #include "datosia.h"
 #include "vector2d.h"
+#include "generadoraleatorio.h"
 #include <cmath>
 
 // Sistema de Razonamiento
@@ -11,6 +12,7 @@
 class SistemaRazonamiento {
 private:
     PerfilIA perfil;                   // Perfil de comportamiento
+    GeneradorAleatorio* aleatorio;     // Generador del nivel (no es dueño)
 
     // Umbrales de decision
     float distanciaEvadir;             // < 100 px → EVADIR
@@ -35,7 +37,7 @@ private:
 public:
     // ========== CONSTRUCTOR ==========
     SistemaRazonamiento();
-    SistemaRazonamiento(const PerfilIA& perfil);
+    SistemaRazonamiento(const PerfilIA& perfil, GeneradorAleatorio* gen = nullptr);
     ~SistemaRazonamiento();
 
     // ========== METODO PRINCIPAL ==========
@@ -1,7 +1,6 @@
 #include "submarino.h"
 #include "torpedo.h"
 #include <cmath>
-#include <cstdlib>
 #include <QColor>
 
 #ifndef M_PI
@@ -13,7 +12,8 @@
 Submarino::Submarino()
     : Enemigo(Vector2D(100, 100), TipoEntidad::ENEMIGO_SUBMARINO),
     estado(EstadoSubmarino::PATRULLANDO),
-    agenteIA(new AgenteIA(this, nullptr)),
+    aleatorio(&GeneradorAleatorio::porDefecto()),
+    agenteIA(new AgenteIA(this, nullptr, aleatorio)),
     puntoPatrulla(200, 100),
     tiempoEnPunto(0.0f),
     tiempoEsperaPunto(2.0f),
@@ -34,10 +34,11 @@ Submarino::Submarino()
     elegirNuevoPuntoPatrulla();
 }
 
-Submarino::Submarino(const Vector2D& pos)
+Submarino::Submarino(const Vector2D& pos, GeneradorAleatorio* gen)
     : Enemigo(pos, TipoEntidad::ENEMIGO_SUBMARINO),
     estado(EstadoSubmarino::PATRULLANDO),
-    agenteIA(new AgenteIA(this, nullptr)),
+    aleatorio(gen ? gen : &GeneradorAleatorio::porDefecto()),
+    agenteIA(new AgenteIA(this, nullptr, aleatorio)),
     puntoPatrulla(pos.x + 200, pos.y),
     tiempoEnPunto(0.0f),
     tiempoEsperaPunto(2.0f),
@@ -192,6 +193,16 @@ void Submarino::renderizar(QPainter& painter) {
     painter.drawRect(posicion.x, posicion.y - 10, ancho * porcentajeSalud, 5);
 }
 
+QRectF Submarino::getLimitesVisuales() const {
+    // Rota con el rumbo: el circulo que cubre casco, torre y timones,
+    // y la barra de vida (sin rotar) 10 px arriba
+    float radio = std::hypot(ancho / 2.0f + 6, alto / 2.0f + 18) + 2;
+    QRectF casco(posicion.x + ancho / 2.0f - radio, posicion.y + alto / 2.0f - radio,
+                 radio * 2, radio * 2);
+
+    return casco.united(QRectF(posicion.x, posicion.y - 10, ancho, 5));
+}
+
 void Submarino::patrullar(float dt) {
     Vector2D direccion = puntoPatrulla - posicion;
     float distancia = direccion.magnitud();
@@ -266,8 +277,8 @@ void Submarino::actualizarIABasica(float dt) {
 }
 
 void Submarino::elegirNuevoPuntoPatrulla() {
-    float x = posicion.x + (rand() % 400) - 200;
-    float y = profundidad + (rand() % 60) - 30;
+    float x = posicion.x + aleatorio->entero(400) - 200;
+    float y = profundidad + aleatorio->entero(60) - 30;
 
     puntoPatrulla = Vector2D(x, y);
 }
@@ -19,6 +19,7 @@ private:
     EstadoSubmarino estado;
 
     // IA (por ahora basica, luego sera AgenteIA completo)
+    GeneradorAleatorio* aleatorio;   // Generador del nivel (no es dueño)
     AgenteIA* agenteIA;
 
     // Patrullaje
@@ -44,12 +45,13 @@ private:
 public:
     // ========== CONSTRUCTORES ==========
     Submarino();
-    Submarino(const Vector2D& pos);
+    Submarino(const Vector2D& pos, GeneradorAleatorio* gen = nullptr);
     ~Submarino();
 
     // ========== METODOS HEREDADOS ==========
     void actualizar(float dt) override;
     void renderizar(QPainter& painter) override;
+    QRectF getLimitesVisuales() const override;
 
     void patrullar(float dt) override;
     void perseguir(Entidad* objetivo, float dt) override;
@@ -2,6 +2,7 @@
 #define TIPOS_H
 
 #include <QString>
+#include <cstdint>
 
 // ============================================
 // ENUMERACIONES DEL JUEGO
@@ -105,6 +106,34 @@ struct CajaColision {
     }
 };
 
+// Referencia a una entidad del MotorFisica (ranura + generacion)
+// Al retirarse la entidad su ranura cambia de generacion: los handles
+// viejos dejan de ser validos aunque la ranura se reutilice, y se
+// comprueba en O(1) sin tocar la entidad (que puede ya no existir)
+struct HandleEntidad {
+    static constexpr uint32_t NULO = 0xFFFFFFFFu;
+
+    uint32_t ranura;
+    uint32_t generacion;
+
+    HandleEntidad() : ranura(NULO), generacion(0) {}
+
+    HandleEntidad(uint32_t _ranura, uint32_t _generacion)
+        : ranura(_ranura), generacion(_generacion) {}
+
+    bool esNulo() const { return ranura == NULO; }
+
+    bool operator==(const HandleEntidad& otro) const {
+        return ranura == otro.ranura && generacion == otro.generacion;
+    }
+    bool operator!=(const HandleEntidad& otro) const { return !(*this == otro); }
+
+    // Orden arbitrario pero estable: clave de std::map/std::set
+    bool operator<(const HandleEntidad& otro) const {
+        return ranura != otro.ranura ? ranura < otro.ranura : generacion < otro.generacion;
+    }
+};
+
 // Estructura para sprites (simplificada por ahora)
 struct Sprite {
     // Path de la imagen
@@ -1,4 +1,6 @@
 #include "torpedo.h"
+#include "poolobjetos.h"
+#include <algorithm>
 #include <cmath>
 #include <QColor>
 
@@ -17,6 +19,7 @@ Torpedo::Torpedo()
     trayectoria(nullptr) {
 
     setDimensiones(24, 8);
+    setMovimientoRapido(true);     // 200+ px/s con 8 px de alto
 
     trayectoria = new TrayectoriaParabolica(0, 0, 50.0f);
     setFisica(trayectoria);
@@ -31,6 +34,7 @@ Torpedo::Torpedo(const Vector2D& pos, float angulo, float velocidad)
     trayectoria(nullptr) {
 
     setDimensiones(24, 8);
+    setMovimientoRapido(true);     // 200+ px/s con 8 px de alto
 
     configurarTrayectoria(pos, angulo, velocidad);
 }
@@ -39,6 +43,16 @@ Torpedo::~Torpedo() {
     trayectoria = nullptr;
 }
 
+// ========== MEMORIA ==========
+
+void* Torpedo::operator new(std::size_t tamanio) {
+    return PoolObjetos<Torpedo>::reservarMemoria(tamanio);
+}
+
+void Torpedo::operator delete(void* memoria, std::size_t tamanio) {
+    PoolObjetos<Torpedo>::liberarMemoria(memoria, tamanio);
+}
+
 // ========== METODOS HEREDADOS ==========
 
 void Torpedo::actualizar(float dt) {
@@ -52,7 +66,7 @@ void Torpedo::actualizar(float dt) {
     }
 
     if (trayectoria) {
-        trayectoria->aplicar(this);
+        trayectoria->aplicar(this, dt);
     }
 
     actualizarColision();
@@ -128,6 +142,22 @@ void Torpedo::renderizar(QPainter& painter) {
     }
 }
 
+QRectF Torpedo::getLimitesVisuales() const {
+    // Rota con la velocidad: el circulo que cubre cuerpo, ojiva y aletas
+    float radio = std::hypot(ancho / 2.0f + 6, alto / 2.0f + 6) + 2;
+    QRectF cuerpo(posicion.x + ancho / 2.0f - radio, posicion.y + alto / 2.0f - radio,
+                  radio * 2, radio * 2);
+
+    // Estela: 4 burbujas hacia atras desde la esquina
+    float colaX = posicion.x - velocidad.x * 0.04f;
+    float colaY = posicion.y - velocidad.y * 0.04f;
+    QRectF estela = QRectF(QPointF(std::min(posicion.x, colaX), std::min(posicion.y, colaY)),
+                           QPointF(std::max(posicion.x, colaX), std::max(posicion.y, colaY)))
+                        .adjusted(-2, -2, 2, 2);
+
+    return cuerpo.united(estela);
+}
+
 void Torpedo::onColision(Entidad* otra) {
     if (!otra) return;
 
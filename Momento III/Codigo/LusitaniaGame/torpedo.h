@@ -4,6 +4,7 @@
 #include "entidad.h"
 #include "trayectoriaparabolica.h"
 #include <QPainter>
+#include <cstddef>
 
 // Torpedo - Proyectil con fisica parabolica
 // Disparado por submarinos enemigos
@@ -21,10 +22,16 @@ public:
     Torpedo(const Vector2D& pos, float angulo, float velocidad);
     ~Torpedo();
 
+    // ========== MEMORIA ==========
+    // Se crean y destruyen muy seguido: usan un pool en vez del heap
+    static void* operator new(std::size_t tamanio);
+    static void operator delete(void* memoria, std::size_t tamanio);
+
     // ========== METODOS HEREDADOS ==========
     void actualizar(float dt) override;
     void renderizar(QPainter& painter) override;
     void onColision(Entidad* otra) override;
+    QRectF getLimitesVisuales() const override;
 
     // ========== CONFIGURACION ==========
     void configurarTrayectoria(const Vector2D& posInicial, float angulo, float vel);
@@ -1,16 +1,19 @@
 #include "trayectoriaparabolica.h"
+#include "poolobjetos.h"
 
 // ========== CONSTRUCTORES ==========
 
 TrayectoriaParabolica::TrayectoriaParabolica()
-    : v0x(0.0f), v0y(0.0f), gravedad(50.0f),
+    : ComponenteFisica(TipoFisica::PARABOLICA),
+    v0x(0.0f), v0y(0.0f), gravedad(50.0f),
     tiempoInicio(0.0f), tiempoActual(0.0f), posicionInicial(0, 0) {
     // Constructor por defecto
     // g = 50 px/s² simula resistencia del agua
 }
 
 TrayectoriaParabolica::TrayectoriaParabolica(float vx, float vy, float g)
-    : v0x(vx), v0y(vy), gravedad(g),
+    : ComponenteFisica(TipoFisica::PARABOLICA),
+    v0x(vx), v0y(vy), gravedad(g),
     tiempoInicio(0.0f), tiempoActual(0.0f), posicionInicial(0, 0) {
     // Constructor con parametros
 }
@@ -19,6 +22,16 @@ TrayectoriaParabolica::~TrayectoriaParabolica() {
     // Destructor vacio
 }
 
+// ========== MEMORIA ==========
+
+void* TrayectoriaParabolica::operator new(std::size_t tamanio) {
+    return PoolObjetos<TrayectoriaParabolica>::reservarMemoria(tamanio);
+}
+
+void TrayectoriaParabolica::operator delete(void* memoria, std::size_t tamanio) {
+    PoolObjetos<TrayectoriaParabolica>::liberarMemoria(memoria, tamanio);
+}
+
 // ========== CALCULO DE LA FISICA ==========
 
 Vector2D TrayectoriaParabolica::calcularPosicion(float t) const {
@@ -46,8 +59,9 @@ Vector2D TrayectoriaParabolica::calcular(Entidad* e, float dt) {
     return calcularPosicion(tiempoActual);
 }
 
-void TrayectoriaParabolica::aplicar(Entidad* e) {
+void TrayectoriaParabolica::aplicar(Entidad* e, float dt) {
     if (!e) return;
+    (void)dt; // El tiempo avanza en calcular()
 
     // Calcular nueva posicion
     Vector2D nuevaPosicion = calcularPosicion(tiempoActual);
@@ -3,13 +3,14 @@
 
 #include "componentefisica.h"
 #include "entidad.h"
+#include <cstddef>
 
 // Movimiento Parabolico
 // Usado para: Torpedos submarinos (Nivel 1)
 // Ecuaciones:
 //   x(t) = x₀ + v₀ₓ × t
 //   y(t) = y₀ + v₀ᵧ × t - ½ × g × t²
-class TrayectoriaParabolica : public ComponenteFisica {
+class TrayectoriaParabolica final : public ComponenteFisica {
 private:
     float v0x;                  // Velocidad inicial en X
     float v0y;                  // Velocidad inicial en Y
@@ -27,9 +28,14 @@ public:
     TrayectoriaParabolica(float vx, float vy, float g);
     ~TrayectoriaParabolica();
 
+    // ========== MEMORIA ==========
+    // Se crean y destruyen muy seguido: usan un pool en vez del heap
+    static void* operator new(std::size_t tamanio);
+    static void operator delete(void* memoria, std::size_t tamanio);
+
     // ========== METODOS HEREDADOS ==========
     Vector2D calcular(Entidad* e, float dt) override;
-    void aplicar(Entidad* e) override;
+    void aplicar(Entidad* e, float dt) override;
 
     // ========== CONFIGURACION ==========
     void setVelocidadInicial(float vx, float vy);
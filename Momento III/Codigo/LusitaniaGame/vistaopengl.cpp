@@ -0,0 +1,114 @@
+#include "vistaopengl.h"
+#include "gamewidget.h"
+#include "perfilador.h"
+#include <QOpenGLContext>
+#include <QOpenGLFunctions>
+#include <QPainter>
+
+// ========== CONSTRUCTOR ==========
+
+VistaOpenGL::VistaOpenGL(GameWidget* juegoPadre)
+    : QOpenGLWidget(juegoPadre),
+    juego(juegoPadre),
+    renderizador(nullptr),
+    disponible(false) {
+
+    setFormat(formatoRequerido());
+
+    // El foco y el mouse se quedan en el GameWidget
+    setFocusPolicy(Qt::NoFocus);
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+
+    renderizador = new RenderizadorGL();
+}
+
+VistaOpenGL::~VistaOpenGL() {
+    makeCurrent();
+    liberarGL();
+    doneCurrent();
+
+    delete renderizador;
+    renderizador = nullptr;
+}
+
+QSurfaceFormat VistaOpenGL::formatoRequerido() {
+    QSurfaceFormat formato;
+    formato.setVersion(3, 3);
+    formato.setProfile(QSurfaceFormat::CoreProfile);
+    formato.setStencilBufferSize(8);
+    return formato;
+}
+
+void VistaOpenGL::liberarGL() {
+    if (renderizador) {
+        renderizador->liberar();
+    }
+}
+
+// ========== OPENGL ==========
+
+void VistaOpenGL::initializeGL() {
+    // Si la vista cambia de ventana el contexto se recrea: liberar antes
+    connect(context(), &QOpenGLContext::aboutToBeDestroyed, this, [this]() {
+        makeCurrent();
+        liberarGL();
+        doneCurrent();
+    });
+
+    disponible = renderizador->inicializar();
+    if (!disponible) {
+        emit noDisponible();
+    }
+}
+
+void VistaOpenGL::paintGL() {
+    TemporizadorPerfil t(SeccionPerfil::RENDER);
+
+    QOpenGLFunctions* gl = context()->functions();
+    gl->glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    gl->glClear(GL_COLOR_BUFFER_BIT);
+
+    // ===== NIVEL: EL LOTE DE LA INSTANTANEA =====
+    // La simulacion ya lo grabo; si la instantanea viene en QPicture
+    // (antes de saber el backend) se reproduce en el lote propio
+    const LoteDibujo* nivel = nullptr;
+    if (disponible) {
+        nivel = juego->getLoteNivel();
+        if (!nivel) {
+            lote.iniciar(size(), devicePixelRatioF());
+            {
+                QPainter grabador(&lote);
+                grabador.setRenderHint(QPainter::Antialiasing);
+                juego->dibujarNivel(grabador);
+            }
+            nivel = &lote;
+        }
+        renderizador->subir(*nivel);
+    }
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    if (nivel) {
+        // Lo diferido (texto, caminos) va con QPainter en su lugar del orden
+        int dibujadas = 0;
+        painter.beginNativePainting();
+
+        for (const DibujoDiferido& dibujo : nivel->getDiferidos()) {
+            renderizador->dibujar(*nivel, dibujadas, dibujo.instancia);
+            dibujadas = dibujo.instancia;
+
+            painter.endNativePainting();
+            nivel->dibujarDiferido(painter, dibujo);
+            painter.beginNativePainting();
+        }
+
+        renderizador->dibujar(*nivel, dibujadas, nivel->getNumInstancias());
+        painter.endNativePainting();
+
+        renderizador->terminarFrame();
+    }
+
+    // ===== HUD, PERFILADOR Y PAUSA =====
+    juego->dibujarInterfaz(painter);
+}
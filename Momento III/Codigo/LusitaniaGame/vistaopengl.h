@@ -0,0 +1,48 @@
+#ifndef VISTAOPENGL_H
+#define VISTAOPENGL_H
+
+#include "lotedibujo.h"
+#include "renderizadorgl.h"
+#include <QOpenGLWidget>
+#include <QSurfaceFormat>
+
+class GameWidget;
+
+// Backend OpenGL de GameWidget (--render opengl)
+// Cubre al GameWidget, que sigue manejando la simulacion y el teclado.
+// El hilo de simulacion graba el nivel en el LoteDibujo de cada
+// instantanea con el mismo renderizar() del backend QPainter, y aqui
+// RenderizadorGL solo lo sube y lo dibuja con llamadas instanciadas; el
+// HUD y la pausa (texto, pocos elementos) van con el QPainter de Qt
+// sobre OpenGL.
+class VistaOpenGL : public QOpenGLWidget {
+    Q_OBJECT
+
+private:
+    GameWidget* juego;
+    RenderizadorGL* renderizador;
+    LoteDibujo lote;            // Solo si la instantanea no trae lote
+    bool disponible;
+
+    void liberarGL();
+
+public:
+    // ========== CONSTRUCTOR ==========
+    explicit VistaOpenGL(GameWidget* juego);
+    ~VistaOpenGL();
+
+    // OpenGL 3.3 core, con stencil para los caminos del QPainter de Qt
+    static QSurfaceFormat formatoRequerido();
+
+    bool estaDisponible() const { return disponible; }
+
+signals:
+    // El contexto no sirve (sin 3.3 / ES 3.0): el juego vuelve a QPainter
+    void noDisponible();
+
+protected:
+    void initializeGL() override;
+    void paintGL() override;
+};
+
+#endif // VISTAOPENGL_H
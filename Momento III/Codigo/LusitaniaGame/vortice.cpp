@@ -1,7 +1,8 @@
 #include "vortice.h"
+#include "poolobjetos.h"
 #include <QColor>
+#include <algorithm>
 #include <cmath>
-#include <cstdlib>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -21,7 +22,7 @@ Vortice::Vortice()
 
     setDimensiones(radioInicial * 2, radioInicial * 2);
     fisicaVortice = new FisicaVortice(posicion, radioInicial, 0.15f);
-    inicializarParticulas();
+    inicializarParticulas(GeneradorAleatorio::porDefecto());
 }
 
 Vortice::Vortice(const Vector2D& centro)
@@ -36,10 +37,10 @@ Vortice::Vortice(const Vector2D& centro)
 
     setDimensiones(radioInicial * 2, radioInicial * 2);
     fisicaVortice = new FisicaVortice(centro, radioInicial, 0.15f);
-    inicializarParticulas();
+    inicializarParticulas(GeneradorAleatorio::porDefecto());
 }
 
-Vortice::Vortice(const Vector2D& centro, float radio, float vida)
+Vortice::Vortice(const Vector2D& centro, float radio, float vida, GeneradorAleatorio* gen)
     : Entidad(centro, TipoEntidad::VORTICE),
     fisicaVortice(nullptr),
     radioActual(radio),
@@ -51,20 +52,33 @@ Vortice::Vortice(const Vector2D& centro, float radio, float vida)
 
     setDimensiones(radio * 2, radio * 2);
     fisicaVortice = new FisicaVortice(centro, radio, 0.15f);
-    inicializarParticulas();
+    inicializarParticulas(gen ? *gen : GeneradorAleatorio::porDefecto());
 }
 
 Vortice::~Vortice() {
+    // fisicaVortice no se registra con setFisica (el vortice no se mueve),
+    // asi que Entidad no lo libera: es del vortice
+    delete fisicaVortice;
     fisicaVortice = nullptr;
 }
 
+// ========== MEMORIA ==========
+
+void* Vortice::operator new(std::size_t tamanio) {
+    return PoolObjetos<Vortice>::reservarMemoria(tamanio);
+}
+
+void Vortice::operator delete(void* memoria, std::size_t tamanio) {
+    PoolObjetos<Vortice>::liberarMemoria(memoria, tamanio);
+}
+
 // ========== INICIALIZACION ==========
 
-void Vortice::inicializarParticulas() {
+void Vortice::inicializarParticulas(GeneradorAleatorio& aleatorio) {
     for (int i = 0; i < 20; i++) {
         particulas[i].angulo = (i * 18.0f) * M_PI / 180.0f;
         particulas[i].distancia = (i / 20.0f) * radioInicial;
-        particulas[i].velocidadAngular = 2.0f + (rand() % 100) / 100.0f;
+        particulas[i].velocidadAngular = 2.0f + aleatorio.entero(100) / 100.0f;
     }
 }
 
@@ -170,13 +184,19 @@ void Vortice::renderizar(QPainter& painter) {
     painter.restore();
 }
 
+QRectF Vortice::getLimitesVisuales() const {
+    // El anillo de atraccion es lo que mas sobresale (posicion = centro)
+    float alcance = std::max(radioActual, rangoAtraccion) + 2;
+    return QRectF(posicion.x - alcance, posicion.y - alcance, alcance * 2, alcance * 2);
+}
+
 void Vortice::onColision(Entidad* otra) {
     (void)otra;
 }
 
 // ========== METODOS ESPECIFICOS ==========
 
-void Vortice::aplicarFuerzaA(Entidad* e) {
+void Vortice::aplicarFuerzaA(Entidad* e, float dt) {
     if (!e || !activo) return;
 
     Vector2D posicionEntidad = e->getPosicion();
@@ -202,7 +222,7 @@ void Vortice::aplicarFuerzaA(Entidad* e) {
 
     // Aplicar la fuerza a la velocidad de la entidad
     Vector2D velocidadActual = e->getVelocidad();
-    e->setVelocidad(velocidadActual + fuerza * 0.016f);  // dt aproximado
+    e->setVelocidad(velocidadActual + fuerza * dt);
 }
 
 float Vortice::getRadioActual() const {
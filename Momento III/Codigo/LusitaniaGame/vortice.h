@@ -3,7 +3,9 @@
 
 #include "entidad.h"
 #include "fisicavortice.h"
+#include "generadoraleatorio.h"
 #include <QPainter>
+#include <cstddef>
 
 // Vortice - Remolino submarino peligroso (Nivel 3)
 // Atrae entidades cercanas con fuerza de succión
@@ -27,22 +29,28 @@ private:
     };
     Particula particulas[20];         // 20 particulas en espiral
 
-    void inicializarParticulas();
+    void inicializarParticulas(GeneradorAleatorio& aleatorio);
 
 public:
     // ========== CONSTRUCTORES ==========
     Vortice();
     Vortice(const Vector2D& centro);
-    Vortice(const Vector2D& centro, float radio, float vida);
+    Vortice(const Vector2D& centro, float radio, float vida, GeneradorAleatorio* gen = nullptr);
     ~Vortice();
 
+    // ========== MEMORIA ==========
+    // Se crean y destruyen muy seguido: usan un pool en vez del heap
+    static void* operator new(std::size_t tamanio);
+    static void operator delete(void* memoria, std::size_t tamanio);
+
     // ========== METODOS HEREDADOS ==========
     void actualizar(float dt) override;
     void renderizar(QPainter& painter) override;
     void onColision(Entidad* otra) override;
+    QRectF getLimitesVisuales() const override;
 
     // ========== METODOS ESPECIFICOS ==========
-    void aplicarFuerzaA(Entidad* e);
+    void aplicarFuerzaA(Entidad* e, float dt);
     float getRadioActual() const;
     float getTiempoRestante() const;
     bool haExpirado() const;